@@ -3,17 +3,25 @@
 #include "data/DataStructs.hpp"
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
 
 struct Task
 {
     std::function<void()> func;
-    int interval; // Interval in seconds
-    std::chrono::time_point<std::chrono::system_clock> nextRunTime;
-    bool stopFlag = false; // Remove tasks flag
+    std::chrono::milliseconds interval; // Zero runs the task once
+    std::chrono::steady_clock::time_point nextRunTime;
+    std::chrono::milliseconds jitter; // Each run is delayed by a random amount up to this
     int id;
 
-    Task(std::function<void()> func, int interval, std::chrono::time_point<std::chrono::system_clock> startTime, int id)
-        : func(std::move(func)), interval(interval), nextRunTime(startTime), id(id) {}
+    Task(std::function<void()> func,
+        std::chrono::milliseconds interval,
+        std::chrono::steady_clock::time_point startTime,
+        int id,
+        std::chrono::milliseconds jitter = std::chrono::milliseconds::zero())
+        : func(std::move(func)), interval(interval), nextRunTime(startTime), jitter(jitter), id(id) {}
 };
 
 struct EventPayload
@@ -23,5 +31,6 @@ struct EventPayload
     CharacterDataStruct characterData;
     PositionStruct positionData;
     MessageStruct messageStruct;
-    std::string rawMessage; // raw message string, used by event-specific handlers (e.g. savePositions)
+    std::string_view rawMessage;                     // raw frame for diagnostics; only valid while the payload is being dispatched
+    std::shared_ptr<const nlohmann::json> document; // message parsed once by MessageHandler; handlers read the body from here
 };
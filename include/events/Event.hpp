@@ -1,6 +1,7 @@
 #pragma once
 #include "data/DataStructs.hpp"
 #include <boost/asio.hpp>
+#include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
@@ -127,16 +128,21 @@ class Event
         SAVE_PLAY_TIME, // Persist play time from chunk-server to characters.total_play_time_sec
 
         // Online status recovery after chunk-server reconnect
-        MARK_CHARACTERS_ONLINE // Batch mark character IDs as is_online=true (sent on chunk-server reconnect)
+        MARK_CHARACTERS_ONLINE, // Batch mark character IDs as is_online=true (sent on chunk-server reconnect)
+
+        // Operations
+        RELOAD_STATIC_WORLD_DATA // Re-read config/mobs/items/NPCs and rebuild the chunk-server world bundle
     }; // Define more event types as needed
     Event() = default; // Default constructor
-    Event(EventType type, int clientID, const EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket);
-    Event(EventType type, int clientID, const EventData data, const TimestampStruct &timestamps);
-    Event(EventType type, int clientID, const EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, const TimestampStruct &timestamps);
+    // The payload is moved once into shared immutable storage; copying an Event
+    // (queue hops, thread-pool tasks) only bumps a refcount.
+    Event(EventType type, int clientID, EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket);
+    Event(EventType type, int clientID, EventData data, const TimestampStruct &timestamps);
+    Event(EventType type, int clientID, EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, const TimestampStruct &timestamps);
     // Event(EventType type, int clientID, const EventData data);
 
-    // Get Event Data
-    const EventData getData() const;
+    // Get Event Data (read-only view of the shared payload)
+    const EventData &getData() const;
     // Get Client ID
     int getClientID() const;
     // Get Client Socket
@@ -151,7 +157,7 @@ class Event
   private:
     int clientID;
     EventType type;
-    EventData eventData;
+    std::shared_ptr<const EventData> eventData;
     std::shared_ptr<boost::asio::ip::tcp::socket> currentClientSocket;
     TimestampStruct timestamps_;
     bool hasTimestamps_ = false;
@@ -4,7 +4,8 @@
 #include "events/EventQueue.hpp"
 #include "game_server/GameServer.hpp"
 #include "utils/JSONParser.hpp"
-#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 class EventDispatcher
 {
@@ -16,6 +17,11 @@ class EventDispatcher
     void dispatchPingDirectly(const Event &pingEvent);
 
   private:
+    using Handler = void (EventDispatcher::*)(const EventPayload &, std::shared_ptr<boost::asio::ip::tcp::socket>);
+
+    /// Fills routes_ once at construction; eventType strings map straight to member handlers
+    void buildRoutes();
+
     void handleJoinGame(const EventPayload &payload, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
     void handleMoveCharacter(const EventPayload &payload, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
     void handleDisconnect(const EventPayload &payload, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
@@ -88,6 +94,9 @@ class EventDispatcher
     // Online status recovery
     void handleMarkCharactersOnline(const EventPayload &payload, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
 
+    // Operations
+    void handleReloadStaticWorldData(const EventPayload &payload, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+
     EventQueue &eventQueue_;
     EventQueue &eventQueuePing_;
     GameServer *gameServer_;
@@ -95,7 +104,6 @@ class EventDispatcher
     std::shared_ptr<spdlog::logger> log_;
     JSONParser &jsonParser_;
 
-    std::vector<Event> eventsBatch_;
-    constexpr static int BATCH_SIZE = 10;
-    mutable std::mutex dispatchMutex_; ///< CRITICAL-3: serialises concurrent dispatch() calls from io_context threads
+    /// eventType → handler; read-only after construction, so lookups are lock-free
+    std::unordered_map<std::string_view, Handler> routes_;
 };
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <chrono>
+#include <mutex>
+#include <optional>
 #include <string>
 
 #include "Event.hpp"
@@ -124,7 +127,28 @@ class EventHandler
     // Online status recovery
     void handleMarkCharactersOnlineEvent(const Event &event);
 
+    // Operations
+    /// Only for registered chunk servers, and at most once per cooldown
+    void handleReloadStaticWorldDataEvent(const Event &event);
+
+    // Static world bundle (cached catalog responses replayed to joining chunk servers)
+    bool buildStaticWorldBundle(int clientID,
+        const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket,
+        std::vector<StaticWorldBundle::Message> &messages);
+    /// Sends a catalog response, or records it when the calling thread is building the bundle
+    void sendCatalogResponse(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket,
+        const std::string &status,
+        const nlohmann::json &response);
+    /// Same, for a response already serialised as JSON text (ResponseStream)
+    void sendCatalogResponse(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket,
+        std::string responseData);
+    /// Marks the bundle being built on this thread as incomplete (no-op outside a build)
+    void markCatalogResponseFailed();
+
     NetworkManager &networkManager_;
     GameServices &gameServices_;
     std::shared_ptr<spdlog::logger> log_;
+
+    std::mutex staticWorldReloadMutex_; ///< guards lastStaticWorldReload_
+    std::optional<std::chrono::steady_clock::time_point> lastStaticWorldReload_;
 };
\ No newline at end of file
@@ -1,20 +1,83 @@
 #pragma once
-#include <queue>
-#include <mutex>
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "Event.hpp"
 
+/**
+ * Bounded multi-producer/multi-consumer event queue.
+ *
+ * Events live in a fixed ring of slots, each tagged with a sequence number
+ * (Vyukov-style), so push/pop only contend on two atomic cursors. Threads fall
+ * back to a condition variable only when they must sleep: consumers when the
+ * queue is empty, producers when it is full (back-pressure instead of dropping
+ * saves). Wakeups are skipped entirely while nobody is sleeping.
+ */
 class EventQueue {
 public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 8192;
+
+    /// @param capacity Number of slots; rounded up to a power of two
+    explicit EventQueue(std::size_t capacity = DEFAULT_CAPACITY);
+
+    EventQueue(const EventQueue &) = delete;
+    EventQueue &operator=(const EventQueue &) = delete;
+
     void push(const Event& event);
+    void push(Event&& event);
+    /// Blocks until an event is available; false once the queue is closed and empty
     bool pop(Event& event);
 
     void pushBatch(const std::vector<Event> &events);
     bool popBatch(std::vector<Event> &events, int batchSize);
     bool empty();
 
+    /// Wake blocked consumers and let pop()/popBatch() return false once the queue is
+    /// drained. Producers must already be stopped; pushes are not rejected.
+    void close();
+
+    /// Non-blocking variants; false when the queue is full / empty
+    bool tryPush(const Event &event);
+    bool tryPush(Event &&event);
+    bool tryPop(Event &event);
+
+    /// Approximate number of queued events (exact when producers/consumers are idle)
+    std::size_t depth() const;
+    /// Largest depth observed since construction
+    std::size_t highWatermark() const { return highWatermark_.load(std::memory_order_relaxed); }
+    std::size_t capacity() const { return mask_ + 1; }
+
 private:
-    std::queue<Event> queue;
+    struct alignas(64) Slot
+    {
+        std::atomic<std::size_t> sequence{0};
+        Event event;
+    };
+
+    template <class E>
+    bool tryPushImpl(E &&event);
+    template <class E>
+    void pushImpl(E &&event);
+
+    void notifyConsumers();
+    void notifyProducers();
+    void updateHighWatermark();
+
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(64) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(64) std::atomic<std::size_t> dequeuePos_{0};
+    alignas(64) std::atomic<std::size_t> highWatermark_{0};
+
+    // Sleep/wake fallback; only touched when a thread actually has to block
     std::mutex mtx;
-    std::condition_variable cv;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+    std::atomic<int> sleepingConsumers_{0};
+    std::atomic<int> sleepingProducers_{0};
+    std::atomic<bool> closed_{false};
 };
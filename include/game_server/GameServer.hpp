@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <string>
 #include <iostream>
@@ -12,6 +13,7 @@
 #include "events/EventHandler.hpp"
 #include "utils/Logger.hpp"
 #include "utils/Scheduler.hpp"
+#include "utils/ShardedExecutor.hpp"
 #include "utils/ThreadPool.hpp"
 #include "services/SpawnZoneManager.hpp"
 
@@ -28,10 +30,11 @@ public:
     
     ~GameServer();
 
-    void processBatch(const std::vector<Event> &eventsBatch);
-    void processPingBatch(const std::vector<Event>& pingEvents);
+    void processBatch(std::vector<Event> eventsBatch);
+    void processPingBatch(std::vector<Event> pingEvents);
 
     void startMainEventLoop();
+    /// Drain the event queues and every dispatched event, then stop the scheduler
     void stop();
 
     void mainEventLoopGS();
@@ -40,6 +43,9 @@ public:
 
 
 private:
+    /// Lane key: events for the same character/client (or chunk socket) run in order
+    static ShardedExecutor::Key laneKeyFor(const Event &event);
+
     std::atomic<bool> running_{true};
 
     std::thread event_game_server_thread_;
@@ -55,6 +61,8 @@ private:
     std::mutex eventMutex;
     std::condition_variable eventCondition;
 
+    // Declared before threadPool_ so the pool (and any queued lane drains) is torn down first
+    ShardedExecutor laneExecutor_{threadPool_, 4 * std::max(1u, std::thread::hardware_concurrency())};
     ThreadPool threadPool_{std::thread::hardware_concurrency()};
 
     GameServices& gameServices_;
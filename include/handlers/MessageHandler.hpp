@@ -1,7 +1,10 @@
 #pragma once
 
+#include "network/WireCodec.hpp"
 #include "utils/JSONParser.hpp"
 #include "utils/TimestampUtils.hpp"
+#include <memory>
+#include <string_view>
 
 class MessageHandler
 {
@@ -11,8 +14,10 @@ class MessageHandler
     std::tuple<std::string, ClientDataStruct, ChunkInfoStruct, CharacterDataStruct, PositionStruct, MessageStruct>
     parseMessage(const std::string &message);
 
-    std::tuple<std::string, ClientDataStruct, ChunkInfoStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct>
-    parseMessageWithTimestamps(const std::string &message);
+    /// Parses the message exactly once; every struct (and the timestamps) is extracted from the same
+    /// document, which is returned as well so dispatcher handlers can read the body without re-parsing.
+    std::tuple<std::string, ClientDataStruct, ChunkInfoStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct, std::shared_ptr<const nlohmann::json>>
+    parseMessageWithTimestamps(std::string_view message, WireFormat format = WireFormat::Json);
 
   private:
     JSONParser &jsonParser_;
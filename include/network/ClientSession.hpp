@@ -1,12 +1,16 @@
 #pragma once
 
-#include <array>
 #include <boost/asio.hpp>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "events/EventQueue.hpp"
+#include "network/WireCodec.hpp"
 #include "utils/Logger.hpp"
 
 #include <functional>
@@ -29,15 +33,48 @@ class ClientSession : public std::enable_shared_from_this<ClientSession>
 
     void start();
     void setDisconnectCallback(std::function<void(std::shared_ptr<ClientSession>)> callback);
+    /// Invoked (on the read path) when the peer negotiates a different wire format
+    void setWireFormatCallback(std::function<void(WireFormat)> callback);
+
+    /// Back-pressure from the write side: stop issuing reads after the current one
+    /// completes, until resumeReading(). Safe to call from any thread.
+    void pauseReading();
+    void resumeReading();
+
+    const std::shared_ptr<boost::asio::ip::tcp::socket> &getSocket() const { return socket_; }
 
   private:
+    /// Adaptive read window: starts small for chat-sized clients, grows for chunk-server bursts
+    static constexpr std::size_t MIN_READ_SIZE = 4 * 1024;
+    static constexpr std::size_t MAX_READ_SIZE = 256 * 1024;
+    /// A single frame may not exceed this; the peer is dropped otherwise
+    static constexpr std::size_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+
     void doRead();
-    void processMessage(const std::string &message);
+    void prepareReadSpace();
+    /// Hands every complete frame in the buffer to processMessage; false if the peer must be dropped
+    bool processFrames();
+    void adaptReadSize(std::size_t bytesTransferred, std::size_t offered);
+    void processMessage(std::string_view message);
+    void negotiateWireFormat(const nlohmann::json &handshake);
     void handleClientDisconnect();
 
     std::shared_ptr<boost::asio::ip::tcp::socket> socket_;
-    std::array<char, 1024> dataBuffer_;
-    std::string accumulatedData_;
+
+    // Framing buffer: [readStart_, readEnd_) holds unconsumed bytes, bytes before
+    // scanPos_ are known to contain no delimiter. Consumed bytes are reclaimed by
+    // resetting the cursors (buffer drained) or one memmove (compaction), never by
+    // erasing from the front per message.
+    std::vector<char> readBuffer_;
+    std::size_t readStart_ = 0;
+    std::size_t readEnd_ = 0;
+    std::size_t scanPos_ = 0;
+    std::size_t readSize_ = MIN_READ_SIZE;
+    WireFormat readFormat_ = WireFormat::Json;
+
+    std::mutex readStateMutex_;
+    bool readPaused_ = false;
+    bool readParked_ = false; ///< a read completed while paused and no new read was issued
     Logger &logger_;
     std::shared_ptr<spdlog::logger> log_;
     EventQueue &eventQueue_;
@@ -46,4 +83,5 @@ class ClientSession : public std::enable_shared_from_this<ClientSession>
     EventDispatcher &eventDispatcher_;
     MessageHandler &messageHandler_;
     std::function<void(std::shared_ptr<ClientSession>)> disconnectCallback_;
+    std::function<void(WireFormat)> wireFormatCallback_;
 };
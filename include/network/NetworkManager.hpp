@@ -1,10 +1,13 @@
 #pragma once
 #include <array>
+#include <atomic>
 #include <boost/asio.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
-#include <queue>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -14,6 +17,7 @@
 #include "data/DataStructs.hpp"
 #include "events/EventQueue.hpp"
 #include "network/ClientSession.hpp"
+#include "network/WireCodec.hpp"
 #include "utils/Config.hpp"
 #include "utils/JSONParser.hpp"
 #include "utils/Logger.hpp"
@@ -22,28 +26,109 @@ class GameServer;
 class EventDispatcher; // ✅ Forward declare EventDispatcher
 class MessageHandler;  // ✅ Forward declare MessageHandler
 
+/// What to do with a peer whose write queue is above the high watermark
+enum class SlowConsumerAction
+{
+    Queue,        ///< keep buffering
+    PauseReading, ///< stop reading requests from the peer until its queue drains below the low watermark
+    Disconnect    ///< drop the peer and everything queued for it
+};
+
+struct WriteQueueStatus
+{
+    boost::asio::ip::tcp::socket *socket;
+    size_t queuedBytes;
+    size_t queuedMessages;
+    size_t highWatermark;
+    size_t hardLimit;
+};
+
 class NetworkManager
 {
   public:
+    /// Consulted on every enqueue while a socket is above its high watermark
+    using SlowConsumerPolicy = std::function<SlowConsumerAction(const WriteQueueStatus &)>;
+
     NetworkManager(EventQueue &eventQueue, EventQueue &eventQueuePing, std::tuple<DatabaseConfig, GameServerConfig> &configs, Logger &logger);
     ~NetworkManager();
     void startAccept();
     void startIOEventLoop();
-    void sendResponse(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, const std::string &responseString);
+    /// Stop accepting, stop the IO context and join the IO threads; no new events are queued after this
+    void stop();
+    /// Build the envelope for @p message and queue it, encoded once in the socket's wire format
+    /// @param coalesceKey Messages with the same non-empty key supersede each other while still queued
+    ///                    (e.g. movement acks for one character); only the newest is sent.
+    void sendResponseMessage(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+        const std::string &status,
+        const nlohmann::json &message,
+        std::string coalesceKey = {});
+    void sendResponseMessage(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+        const std::string &status,
+        const nlohmann::json &message,
+        const TimestampStruct &timestamps);
+    /// Queue an already serialised JSON text frame (streamed or cached responses); peers that
+    /// negotiated a binary format get it re-encoded, so prefer sendResponseMessage() otherwise.
+    /// @param responseString Taken by value: pass an rvalue to hand the buffer over without a copy
+    void sendResponse(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+        std::string responseString,
+        std::string coalesceKey = {});
+    /// Queue a frame already encoded in the socket's wire format (see getWireFormat)
+    void sendFrame(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, std::string frame);
+
+    /// Outbound encoding for a socket; JSON until the peer negotiates otherwise
+    void setWireFormat(boost::asio::ip::tcp::socket *socket, WireFormat format);
+    WireFormat getWireFormat(const std::shared_ptr<boost::asio::ip::tcp::socket> &socket);
     std::string generateResponseMessage(const std::string &status, const nlohmann::json &message);
     std::string generateResponseMessage(const std::string &status, const nlohmann::json &message, const TimestampStruct &timestamps);
     void setGameServer(GameServer *GameServer);
     void addActiveSession(std::shared_ptr<ClientSession> session);
     void removeActiveSession(std::shared_ptr<ClientSession> session);
 
+    void setSlowConsumerPolicy(SlowConsumerPolicy policy);
+    /// Bytes waiting in write queues across all sockets
+    size_t getQueuedWriteBytes() const { return queuedWriteBytes_.load(std::memory_order_relaxed); }
+
   private:
+    struct QueuedWrite
+    {
+        std::shared_ptr<const std::string> data;
+        std::string coalesceKey;
+    };
+
     // Per-socket write state: ensures async_write calls are serialised per socket
     // so that concurrent EventHandler threads never race on the same TCP connection.
+    // Everything below is only touched on the strand.
     struct SocketWriteState
     {
         boost::asio::strand<boost::asio::io_context::executor_type> strand;
-        std::queue<std::shared_ptr<const std::string>> writeQueue;
+        std::deque<QueuedWrite> writeQueue;
         bool writePending{false};
+        // Read outside the strand when responses are encoded
+        std::atomic<WireFormat> wireFormat{WireFormat::Json};
+
+        // Back-pressure: bytes waiting in writeQueue and the watermark hysteresis
+        size_t queuedBytes{0};
+        bool aboveHighWatermark{false};
+        bool readingPaused{false};
+
+        // coalesceKey -> position of its queued message, as an absolute sequence
+        // number (front of writeQueue is queueHeadSeq), so lookups stay O(1)
+        std::unordered_map<std::string, uint64_t> coalesceIndex;
+        uint64_t queueHeadSeq{0};
+
+        // Messages of the write currently in flight, gathered into one async_write
+        std::vector<std::shared_ptr<const std::string>> inFlight;
+        std::vector<boost::asio::const_buffer> gatherBuffers;
+
+        // Write statistics, logged when the socket state is dropped
+        uint64_t writesIssued{0};
+        uint64_t messagesWritten{0};
+        uint64_t bytesWritten{0};
+        size_t maxMessagesPerWrite{0};
+        size_t maxBytesPerWrite{0};
+        size_t peakQueuedBytes{0};
+        uint64_t coalescedMessages{0};
+
         explicit SocketWriteState(boost::asio::io_context &ctx)
             : strand(boost::asio::make_strand(ctx))
         {
@@ -53,10 +138,28 @@ class NetworkManager
     std::mutex socketStatesMutex_;
     std::unordered_map<boost::asio::ip::tcp::socket *, std::shared_ptr<SocketWriteState>> socketStates_;
 
+    std::string buildEnvelope(const std::string &status, const nlohmann::json &message, const TimestampStruct *timestamps);
+    void sendEnvelope(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+        const std::string &status,
+        const nlohmann::json &message,
+        const TimestampStruct *timestamps,
+        std::string coalesceKey);
+
     std::shared_ptr<SocketWriteState> getOrCreateSocketState(boost::asio::ip::tcp::socket *sock);
     void removeSocketState(boost::asio::ip::tcp::socket *sock);
     void doNextWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
         std::shared_ptr<SocketWriteState> state);
+    void postFrame(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+        std::shared_ptr<SocketWriteState> state,
+        std::shared_ptr<const std::string> frame,
+        std::string coalesceKey);
+    // Strand-only helpers for the bounded write queue
+    void enqueueWrite(SocketWriteState &state, std::shared_ptr<const std::string> data, std::string coalesceKey);
+    QueuedWrite popWrite(SocketWriteState &state);
+    void clearWriteQueue(SocketWriteState &state);
+    void applyBackPressure(const std::shared_ptr<boost::asio::ip::tcp::socket> &socket, SocketWriteState &state);
+    void releaseBackPressure(SocketWriteState &state, boost::asio::ip::tcp::socket *socket);
+    void setSessionReadingPaused(boost::asio::ip::tcp::socket *socket, bool paused);
 
     static constexpr size_t max_length = 1024;
     boost::asio::io_context io_context_;
@@ -69,6 +172,12 @@ class NetworkManager
     Logger &logger_;
     std::shared_ptr<spdlog::logger> log_;
     JSONParser jsonParser_;
+    size_t maxWriteBatchBytes_;
+    size_t writeHighWatermark_;
+    size_t writeLowWatermark_;
+    size_t writeHardLimit_;
+    SlowConsumerPolicy slowConsumerPolicy_;
+    std::atomic<size_t> queuedWriteBytes_{0};
 
     // These are declared but NOT initialized here!
     std::unique_ptr<EventDispatcher> eventDispatcher_;
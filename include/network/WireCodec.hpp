@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * Encoding of protocol frames on a connection.
+ *
+ * Every connection starts with newline-delimited JSON text. A chunk server may ask
+ * for a binary encoding in its chunkServerConnection handshake by adding
+ * "wireFormat": "msgpack" | "cbor" to the header. From the frame after the
+ * handshake on (inbound), and for every response sent after it was read
+ * (outbound, including the handshake replies), frames are then
+ * [4-byte big-endian payload length][payload]. The envelope ({"header", "body"})
+ * is unchanged; only its encoding differs.
+ */
+enum class WireFormat : uint8_t
+{
+    Json,
+    MessagePack,
+    Cbor
+};
+
+class WireCodec
+{
+  public:
+    static constexpr std::size_t LENGTH_PREFIX_SIZE = 4;
+
+    /// Accepts "json", "msgpack"/"messagepack" and "cbor"; nullopt for anything else
+    static std::optional<WireFormat> fromName(std::string_view name);
+    static const char *name(WireFormat format);
+
+    /// Payload length of a binary frame starting at @p data (LENGTH_PREFIX_SIZE bytes)
+    static std::size_t readLengthPrefix(const char *data);
+
+    /// Decode one frame payload (without newline / length prefix)
+    static nlohmann::json decode(std::string_view payload, WireFormat format);
+
+    /// Encode a complete frame, including the trailing newline or the length prefix
+    static std::string encodeFrame(const nlohmann::json &envelope, WireFormat format);
+    /// Same, from the envelope's two parts, without assembling them into one document first
+    static std::string encodeFrame(const nlohmann::json &body, const nlohmann::json &header, WireFormat format);
+
+    /// Re-encode a newline-terminated JSON text frame; returns it unchanged for WireFormat::Json
+    static std::string transcodeFrame(const std::string &jsonFrame, WireFormat format);
+
+    /**
+     * An envelope with its body already encoded, so that sending it again only costs
+     * encoding the (small) header. Used for large responses replayed to many peers.
+     */
+    struct PreparedEnvelope
+    {
+        std::string encodedBody; ///< map marker, "body" key and body value
+        nlohmann::json header;
+    };
+
+    /// Binary formats only
+    static PreparedEnvelope prepare(const nlohmann::json &envelope, WireFormat format);
+    static std::string finishFrame(const PreparedEnvelope &prepared, const nlohmann::json &header, WireFormat format);
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include "utils/Database.hpp"
+#include "utils/Logger.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+struct AnalyticsSinkSettings
+{
+    std::size_t flushRows = 500;                        ///< buffered rows that trigger a flush before the interval
+    std::chrono::milliseconds flushInterval{1000};      ///< longest a row waits in memory while Postgres keeps up
+    std::size_t maxBufferedBytes = 8 * 1024 * 1024;     ///< memory bound of the in-memory buffer
+    std::string spillPath;                              ///< overflow file; empty drops the oldest rows instead
+};
+
+struct AnalyticsSinkStats
+{
+    std::uint64_t recorded = 0;
+    std::uint64_t flushed = 0;       ///< rows committed to game_analytics (including replayed ones)
+    std::uint64_t dropped = 0;       ///< rows lost to the memory bound or a failed spill
+    std::uint64_t spilled = 0;       ///< rows written to the spill file
+    std::uint64_t failedFlushes = 0;
+    std::size_t bufferedRows = 0;
+    std::size_t bufferedBytes = 0;
+    std::int64_t oldestBufferedMs = 0; ///< age of the oldest row still in memory
+    std::int64_t lastFlushLagMs = 0;   ///< record-to-commit time of the oldest row in the last flush
+};
+
+/**
+ * @brief Buffered ingestion of game_analytics rows.
+ *
+ * record() only queues the row; a dedicated
+ * writer thread sends the queue with one COPY game_analytics FROM STDIN when
+ * flushRows are buffered or flushInterval has passed, so analytics no longer
+ * takes a pooled connection per event away from gameplay saves.
+ *
+ * Memory is bounded by maxBufferedBytes. When Postgres falls behind, the oldest
+ * rows are either appended to spillPath (and replayed before newer rows once
+ * flushes succeed again) or dropped; both are counted in getStats().
+ */
+class AnalyticsSink
+{
+  public:
+    AnalyticsSink(Database &database, Logger &logger);
+    ~AnalyticsSink();
+
+    AnalyticsSink(const AnalyticsSink &) = delete;
+    AnalyticsSink &operator=(const AnalyticsSink &) = delete;
+
+    void start(const AnalyticsSinkSettings &settings);
+    /// Flush what is left (spilling or dropping it if Postgres is unavailable) and stop the writer
+    void stop();
+
+    /// @p characterId 0 is stored as NULL; @p payloadJson must be a serialised JSON value
+    void record(const std::string &eventType, int characterId, const std::string &sessionId,
+        int level, int zoneId, const std::string &payloadJson);
+
+    AnalyticsSinkStats getStats();
+
+  private:
+    struct Row
+    {
+        std::string eventType;
+        std::optional<int> characterId; ///< NULL when the event has no character
+        std::string sessionId;
+        int level = 0;
+        int zoneId = 0;
+        std::string payload;
+        std::chrono::steady_clock::time_point recordedAt;
+    };
+
+    void writerLoop();
+    bool copyRows(const std::deque<Row> &rows);
+    bool replaySpill();
+    /// Enforce maxBufferedBytes; mutex_ must be held. Rows to spill are moved to @p overflow.
+    void trimLocked(std::deque<Row> &overflow);
+    void spill(std::deque<Row> &rows);
+
+    static std::size_t rowBytes(const Row &row);
+    /// Spill files hold one row per line in COPY text format
+    static std::string toSpillLine(const Row &row);
+    static bool fromSpillLine(const std::string &line, Row &row);
+    static void writeRow(pqxx::stream_to &stream, const Row &row);
+
+    Database &database_;
+    std::shared_ptr<spdlog::logger> log_;
+    AnalyticsSinkSettings settings_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Row> buffer_;
+    std::size_t bufferedBytes_ = 0;
+    bool stopFlag_ = false;
+    bool overflowWarned_ = false;
+    AnalyticsSinkStats stats_;
+
+    std::mutex spillMutex_;
+    std::thread writer_;
+};
@@ -0,0 +1,136 @@
+#pragma once
+#include "data/DataStructs.hpp"
+#include "utils/Database.hpp"
+#include "utils/Logger.hpp"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Computes character attributes in memory instead of with the get_character_attributes CTE.
+ *
+ * For every attribute of the character's class formula:
+ *   ROUND(base_value + multiplier * level^exponent)
+ *   + permanent modifiers
+ *   + equipment bonuses (apply_on = 'equip', reduced by the durability tiers)
+ *   + set bonuses (pieces equipped >= pieces_required)
+ *
+ * Class formulas, item equip attributes, set memberships/bonuses and the durability
+ * tiers from game_config are loaded at startup and on reload(). Per character the
+ * inputs (class, level, permanent modifiers, equipped items) are loaded once — with
+ * the login pipeline or on first use — and then kept current by the equip, unequip,
+ * durability and level events, so a refresh needs no database round trip.
+ */
+class CharacterAttributeService
+{
+  public:
+    CharacterAttributeService(Database &database, Logger &logger);
+
+    void loadStaticData();
+    void reload();
+
+    /// Seed a character from already fetched rows (see CharacterManager::loadCharacterFromDatabase()).
+    /// @p equipment: get_character_equipment_stats, @p permanentModifiers: get_character_permanent_modifiers
+    void setCharacterInputs(int characterId, int classId, int level,
+        const pqxx::result &equipment, const pqxx::result &permanentModifiers);
+
+    /// Attributes in entity_attributes id order; loads the character's inputs if they are not cached
+    std::vector<CharacterAttributeStruct> getAttributes(Database &db, int characterId);
+    /// Whether getAttributes() would be answered without reading the database
+    bool isCached(int characterId);
+
+    // Incremental updates. Characters that are not cached are skipped: their inputs are
+    // read fresh on the next getAttributes().
+    void setLevel(int characterId, int level);
+    void equipItem(Database &db, int characterId, const std::string &slotSlug, int inventoryItemId);
+    void unequipItem(int characterId, int inventoryItemId);
+    void setItemDurability(int characterId, int inventoryItemId, int durabilityCurrent);
+    /// Drop whoever has @p inventoryItemId equipped (item transferred or deleted)
+    void forgetInventoryItem(int inventoryItemId);
+    void forgetCharacter(int characterId);
+
+  private:
+    struct ClassFormula
+    {
+        int attributeId = 0;
+        std::string name;
+        std::string slug;
+        double baseValue = 0;
+        double multiplier = 0;
+        double exponent = 0;
+    };
+
+    struct ItemEquipStats
+    {
+        bool isDurable = false;
+        int durabilityMax = 0;
+        std::vector<std::pair<int, int>> attributes; ///< attribute id, value
+    };
+
+    struct SetBonus
+    {
+        int piecesRequired = 0;
+        int attributeId = 0;
+        int value = 0;
+    };
+
+    /// A missing game_config key behaves like the NULL it was in SQL
+    struct DurabilityTier
+    {
+        std::optional<double> threshold;
+        std::optional<double> penalty;
+    };
+
+    struct StaticTables
+    {
+        std::unordered_map<int, std::vector<ClassFormula>> formulasByClass; ///< sorted by attribute id
+        std::unordered_map<int, ItemEquipStats> items;
+        std::unordered_map<int, std::vector<int>> setsByItem;
+        std::unordered_map<int, std::vector<SetBonus>> setBonuses;
+        std::array<DurabilityTier, 3> durabilityTiers; ///< tier1..tier3
+    };
+
+    struct EquippedItem
+    {
+        int inventoryItemId = 0;
+        int itemId = 0;
+        std::optional<int> durabilityCurrent; ///< NULL counts as full durability
+    };
+
+    struct CharacterState
+    {
+        int classId = 0;
+        int level = 0;
+        std::unordered_map<int, int> permanentBonus;
+        std::unordered_map<std::string, EquippedItem> equippedBySlot;
+
+        // Derived from equippedBySlot with the tables in derivedFrom; rebuilt after a reload
+        std::shared_ptr<const StaticTables> derivedFrom;
+        std::unordered_map<int, int> equipBonus;
+        std::unordered_map<int, int> setPieces;
+    };
+
+    static int equipValue(const StaticTables &tables, const ItemEquipStats &stats, int value, const EquippedItem &item);
+    static void applyItem(CharacterState &state, const StaticTables &tables, const EquippedItem &item, int sign);
+    static void rebuildDerived(CharacterState &state, const std::shared_ptr<const StaticTables> &tables);
+    static std::vector<CharacterAttributeStruct> compute(int characterId, const CharacterState &state, const StaticTables &tables);
+    static CharacterState readInputs(int classId, int level, const pqxx::result &equipment, const pqxx::result &permanentModifiers);
+
+    std::shared_ptr<const StaticTables> currentTables();
+    /// Cached state with derived values matching the current tables; statesMutex_ must be held
+    CharacterState *findState(int characterId);
+
+    Database &database_;
+    Logger &logger_;
+    std::shared_ptr<spdlog::logger> log_;
+
+    std::mutex tablesMutex_;
+    std::shared_ptr<const StaticTables> tables_;
+
+    std::mutex statesMutex_;
+    std::unordered_map<int, CharacterState> states_;
+};
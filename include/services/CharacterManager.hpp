@@ -1,8 +1,13 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <data/DataStructs.hpp>
+#include <services/CharacterAttributeService.hpp>
 #include <iostream>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <utils/Database.hpp>
 #include <utils/Logger.hpp>
 #include <vector>
@@ -10,7 +15,7 @@
 class CharacterManager
 {
   public:
-    CharacterManager(Logger &logger);
+    CharacterManager(Logger &logger, CharacterAttributeService &attributeService);
 
     // Runtime access
     void addOrUpdateCharacter(const CharacterDataStruct &character);
@@ -30,7 +35,6 @@ class CharacterManager
     std::vector<CharacterAttributeStruct> getCharacterAttributesFromDatabase(Database &db, int characterId);
     std::vector<SkillStruct> getCharacterSkillsFromDatabase(Database &db, int characterId);
     std::vector<SkillBarSlotStruct> getCharacterSkillBarFromDatabase(Database &db, int characterId);
-    std::vector<SkillStruct> getMobSkillsFromDatabase(Database &db, int mobId);
     CharacterDataStruct getBasicCharacterDataFromDatabase(Database &db, int accountId, int characterId);
 
     void updateCharacterPosition(Database &db, int accountId, int characterId, const PositionStruct &position);
@@ -41,13 +45,110 @@ class CharacterManager
     /// ARCH-4: Persist current HP and Mana for a single character — called by periodic save task.
     void saveCharacterHpMana(Database &db, int characterId, int currentHp, int currentMana);
 
+    /// Persist a whole position snapshot in one transaction (single UPDATE ... FROM unnest).
+    /// Duplicate characterIds keep the last entry. Returns the number of rows actually updated.
+    int saveCharacterPositionsBulk(Database &db, const std::vector<CharacterDataStruct> &characters);
+
+    /// Persist a whole HP/Mana snapshot in one transaction (single INSERT ... ON CONFLICT from unnest).
+    /// Duplicate characterIds keep the last entry. Returns the number of rows actually written.
+    int saveCharacterHpManaBulk(Database &db, const std::vector<CharacterDataStruct> &characters);
+
+    /// Also marks a still pending disconnect as superseded, so its flush cannot set the character offline again
     void setCharacterOnline(Database &db, int characterId);
     void updatePlayTime(Database &db, int characterId, int64_t sessionPlayTimeSec, int64_t lastSessionPlayTimeSec, bool isDisconnect);
     void resetAllOnline(Database &db);
 
+    // ── Write-behind character state ─────────────────────────────────────────
+    // mark*() update the in-memory character and record the value as pending; repeated
+    // updates to the same character merge (last value wins, play time accumulates).
+    // flushDirtyCharacters() writes everything pending in one transaction of bulk
+    // statements — called by the scheduler every CHARACTER_FLUSH_INTERVAL_SEC and on
+    // shutdown. flushCharacter() writes a single character (disconnect, and before any direct
+    // write to the level/exp/skill point columns so the two cannot reorder).
+    // A failed flush puts its entries back, so they go out with the next one. When the
+    // database rejects a batch it is retried character by character, and a character that
+    // still fails on its own is logged and dropped rather than re-queued forever.
+    void markPositionDirty(int characterId, const PositionStruct &position);
+    void markHpManaDirty(int characterId, int currentHp, int currentMana);
+    void markExperienceDirty(int characterId, int experiencePoints, int level);
+    void markExperienceDebtDirty(int characterId, int experienceDebt);
+    /// @p sessionPlayTimeSec is a delta added to total_play_time_sec
+    void markPlayTimeDirty(int characterId, int64_t sessionPlayTimeSec, int64_t lastSessionPlayTimeSec, bool isDisconnect);
+
+    /// Returns the number of characters written (0 when nothing was pending or the flush failed)
+    int flushDirtyCharacters(Database &db);
+    /// False when the character's pending state could not be written and was put back
+    bool flushCharacter(Database &db, int characterId);
+
+    struct WriteBehindStats
+    {
+        size_t pendingCharacters = 0;
+        size_t pendingFields = 0;        ///< dirty field groups across all pending characters
+        int64_t oldestPendingAgeMs = 0;  ///< current flush lag: age of the oldest unflushed update
+        uint64_t updatesMerged = 0;      ///< updates absorbed by an already pending value
+        uint64_t flushes = 0;
+        uint64_t failedFlushes = 0;
+        uint64_t charactersFlushed = 0;
+        uint64_t charactersQuarantined = 0; ///< pending states dropped after the database rejected them on their own
+        int64_t lastFlushLagMs = 0;      ///< age of the oldest update written by the last flush
+        int64_t lastFlushDurationMs = 0;
+    };
+    WriteBehindStats getWriteBehindStats();
+
   private:
+    enum DirtyField : uint8_t
+    {
+        DirtyPosition = 1 << 0,
+        DirtyHpMana = 1 << 1,
+        DirtyExperience = 1 << 2,
+        DirtyExperienceDebt = 1 << 3,
+        DirtyPlayTime = 1 << 4
+    };
+
+    struct PendingCharacterState
+    {
+        uint8_t dirty = 0;
+        PositionStruct position;
+        int currentHp = 0;
+        int currentMana = 0;
+        int experiencePoints = 0;
+        int level = 0;
+        int experienceDebt = 0;
+        int64_t playTimeSec = 0;
+        int64_t lastSessionPlayTimeSec = 0;
+        bool disconnected = false;
+        bool reconnected = false; ///< logged in again after the disconnect; is_online is set back after writing it
+        std::chrono::steady_clock::time_point dirtySince;
+    };
+    using PendingMap = std::unordered_map<int, PendingCharacterState>;
+
+    /// Pending entry for @p characterId, created if needed; pendingMutex_ must be held
+    PendingCharacterState &pendingEntry(int characterId, DirtyField field);
+    enum class WriteResult
+    {
+        Written,
+        Failed,  ///< connection lost or unavailable; worth retrying as is
+        Rejected ///< the database refused the data
+    };
+    struct FlushOutcome
+    {
+        int written = 0;
+        int requeued = 0;
+        int quarantined = 0;
+    };
+    WriteResult writePending(Database &db, const PendingMap &batch);
+    /// Writes @p batch, falling back to one character at a time when it is rejected; flushMutex_ must be held
+    FlushOutcome flushBatch(Database &db, PendingMap &&batch);
+    void finishFlush(PendingMap &&written, PendingMap &&failedBatch, int quarantined, std::chrono::steady_clock::time_point started);
+
     Logger &logger_;
+    CharacterAttributeService &attributeService_;
     std::shared_ptr<spdlog::logger> log_;
     std::unordered_map<int, CharacterDataStruct> charactersMap_;
     std::shared_mutex mutex_;
+
+    PendingMap pending_;
+    std::mutex pendingMutex_; ///< guards pending_ and writeBehindStats_
+    std::mutex flushMutex_;   ///< one flush at a time, so a failed batch is re-queued before the next is taken
+    WriteBehindStats writeBehindStats_;
 };
\ No newline at end of file
@@ -1,14 +1,18 @@
 #pragma once
+#include "services/AnalyticsSink.hpp"
+#include "services/CharacterAttributeService.hpp"
 #include "services/CharacterManager.hpp"
 #include "services/ChunkManager.hpp"
 #include "services/ClassSpawnZoneManager.hpp"
 #include "services/ClientManager.hpp"
 #include "services/DialogueQuestManager.hpp"
 #include "services/GameConfigService.hpp"
+#include "services/InventoryWriteBehind.hpp"
 #include "services/ItemManager.hpp"
 #include "services/MobManager.hpp"
 #include "services/NPCManager.hpp"
 #include "services/SpawnZoneManager.hpp"
+#include "services/StaticWorldBundle.hpp"
 #include "utils/Database.hpp"
 #include "utils/Logger.hpp"
 
@@ -22,12 +26,16 @@ class GameServices
           itemManager_(database_, logger_),
           npcManager_(database_, logger_),
           spawnZoneManager_(mobManager_, database_, logger_),
-          characterManager_(logger_),
+          characterAttributeService_(database_, logger_),
+          characterManager_(logger_, characterAttributeService_),
+          inventoryWriteBehind_(logger_),
           classSpawnZoneManager_(database_, logger_),
           clientManager_(logger_),
           chunkManager_(logger_),
           dialogueQuestManager_(database_, logger_),
-          gameConfigService_(database_, logger_)
+          gameConfigService_(database_, logger_),
+          staticWorldBundle_(logger_),
+          analyticsSink_(database_, logger_)
     {
     }
 
@@ -59,6 +67,14 @@ class GameServices
     {
         return characterManager_;
     }
+    CharacterAttributeService &getCharacterAttributeService()
+    {
+        return characterAttributeService_;
+    }
+    InventoryWriteBehind &getInventoryWriteBehind()
+    {
+        return inventoryWriteBehind_;
+    }
     ClassSpawnZoneManager &getClassSpawnZoneManager()
     {
         return classSpawnZoneManager_;
@@ -79,6 +95,27 @@ class GameServices
     {
         return gameConfigService_;
     }
+    StaticWorldBundle &getStaticWorldBundle()
+    {
+        return staticWorldBundle_;
+    }
+    AnalyticsSink &getAnalyticsSink()
+    {
+        return analyticsSink_;
+    }
+
+    /// Reload config, mobs, items, NPCs and attribute tables from the database and drop the cached
+    /// chunk-server world bundle so the next join is served the fresh data. Triggered by the
+    /// reloadStaticWorldData event; returns the new bundle version.
+    uint64_t reloadStaticWorldData()
+    {
+        gameConfigService_.reload();
+        mobManager_.loadMobs();
+        itemManager_.loadItems();
+        npcManager_.reloadNPCs();
+        characterAttributeService_.reload();
+        return staticWorldBundle_.invalidate("static world data reloaded");
+    }
 
   private:
     Logger &logger_;
@@ -87,10 +124,14 @@ class GameServices
     ItemManager itemManager_;
     NPCManager npcManager_;
     SpawnZoneManager spawnZoneManager_;
+    CharacterAttributeService characterAttributeService_;
     CharacterManager characterManager_;
+    InventoryWriteBehind inventoryWriteBehind_;
     ClassSpawnZoneManager classSpawnZoneManager_;
     ClientManager clientManager_;
     ChunkManager chunkManager_;
     DialogueQuestManager dialogueQuestManager_;
     GameConfigService gameConfigService_;
+    StaticWorldBundle staticWorldBundle_;
+    AnalyticsSink analyticsSink_;
 };
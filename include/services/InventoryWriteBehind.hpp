@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utils/Database.hpp>
+#include <utils/Logger.hpp>
+
+/**
+ * @brief Write-behind buffer for per-instance inventory updates.
+ *
+ * Quantity, durability and kill-count updates for an existing player_inventory row
+ * are recorded per inventory item id and merged (each carries the new absolute value,
+ * so the last one wins). flushDirtyItems() writes everything pending in one
+ * transaction of three bulk statements; it runs on the scheduler every
+ * INVENTORY_FLUSH_INTERVAL_SEC and on shutdown. A failed flush puts its entries back;
+ * a batch the database rejects is retried item by item, and an item that still fails
+ * on its own is logged and dropped.
+ *
+ * Anything that changes who owns a row or reads rows back must go through a barrier
+ * first: flushItem() before a transfer, drop or equip of that item, flushCharacter()
+ * before statements that address a character's rows by item type and before the
+ * inventory or attributes are loaded. discardItem() drops the pending values of a
+ * row that is about to be deleted.
+ */
+class InventoryWriteBehind
+{
+  public:
+    explicit InventoryWriteBehind(Logger &logger);
+
+    void markQuantityDirty(int characterId, int inventoryItemId, int quantity);
+    void markDurabilityDirty(int characterId, int inventoryItemId, int durabilityCurrent);
+    void markKillCountDirty(int characterId, int inventoryItemId, int killCount);
+    void discardItem(int inventoryItemId);
+
+    /// Returns the number of items written (0 when nothing was pending or the flush failed)
+    int flushDirtyItems(Database &db);
+    /// Barrier for one row: writes its pending values now. Required before the row changes
+    /// hands (transfer, drop), since pending UPDATEs match on the owner they were recorded
+    /// for and would no longer apply, and before it is read back (equip). False when the
+    /// write failed and the values were put back; a caller about to move the row discards them.
+    bool flushItem(Database &db, int inventoryItemId);
+    bool flushCharacter(Database &db, int characterId);
+
+    struct WriteBehindStats
+    {
+        size_t pendingItems = 0;
+        int64_t oldestPendingAgeMs = 0; ///< current flush lag: age of the oldest unflushed update
+        uint64_t updatesMerged = 0;     ///< updates absorbed by an already pending value
+        uint64_t flushes = 0;
+        uint64_t failedFlushes = 0;
+        uint64_t itemsFlushed = 0;
+        uint64_t itemsQuarantined = 0; ///< pending updates dropped after the database rejected them on their own
+        int64_t lastFlushLagMs = 0; ///< age of the oldest update written by the last flush
+        int64_t lastFlushDurationMs = 0;
+    };
+    WriteBehindStats getWriteBehindStats();
+
+  private:
+    enum DirtyField : uint8_t
+    {
+        DirtyQuantity = 1 << 0,
+        DirtyDurability = 1 << 1,
+        DirtyKillCount = 1 << 2
+    };
+
+    struct PendingItemState
+    {
+        uint8_t dirty = 0;
+        int characterId = 0; ///< owner the UPDATE is checked against
+        int quantity = 0;
+        int durabilityCurrent = 0;
+        int killCount = 0;
+        std::chrono::steady_clock::time_point dirtySince;
+    };
+    using PendingMap = std::unordered_map<int, PendingItemState>;
+
+    /// Pending entry for @p inventoryItemId, created if needed; pendingMutex_ must be held
+    PendingItemState &pendingEntry(int characterId, int inventoryItemId, DirtyField field);
+    /// Remove an entry from pending_ and pendingPerCharacter_; pendingMutex_ must be held
+    PendingMap::node_type extractLocked(int inventoryItemId);
+    enum class WriteResult
+    {
+        Written,
+        Failed,  ///< connection lost or unavailable; worth retrying as is
+        Rejected ///< the database refused the data
+    };
+    struct FlushOutcome
+    {
+        int written = 0;
+        int requeued = 0;
+        int quarantined = 0;
+    };
+    /// Writes @p batch, falling back to one item at a time when it is rejected; flushMutex_ must be held
+    FlushOutcome flushBatch(Database &db, PendingMap &&batch);
+    WriteResult writePending(Database &db, const PendingMap &batch);
+    void finishFlush(PendingMap &&written, PendingMap &&failedBatch, int quarantined, std::chrono::steady_clock::time_point started);
+
+    std::shared_ptr<spdlog::logger> log_;
+
+    PendingMap pending_;
+    std::unordered_map<int, size_t> pendingPerCharacter_; ///< lets flushCharacter() skip the scan when nothing is pending
+    std::mutex pendingMutex_;                             ///< guards pending_, pendingPerCharacter_ and writeBehindStats_
+    std::mutex flushMutex_;                               ///< one flush at a time, so a barrier waits for a flush in progress
+    WriteBehindStats writeBehindStats_;
+};
@@ -3,11 +3,16 @@
 #include "utils/Database.hpp"
 #include "utils/Generators.hpp"
 #include "utils/Logger.hpp"
+#include <map>
+#include <shared_mutex>
 
 class MobManager
 {
   public:
     MobManager(Database &database, Logger &logger);
+
+    /// Loads mob templates with their attributes and skills using three set-based queries
+    /// (mobs, all attributes, all skills) grouped by mob_id in memory, then swaps the snapshot in.
     void loadMobs();
 
     std::map<int, MobDataStruct> getMobs() const;
@@ -23,4 +28,6 @@ class MobManager
 
     // Store the mobs in memory as map with mobId as key
     std::map<int, MobDataStruct> mobs_;
+    /// Guards mobs_: readers take a shared lock, loadMobs() only locks to swap in a finished snapshot
+    mutable std::shared_mutex mobsMutex_;
 };
\ No newline at end of file
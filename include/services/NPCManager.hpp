@@ -29,10 +29,17 @@ class NPCManager
 
     /**
      * @brief Load NPCs from database with all related data
-     * Thread-safe operation
+     * Thread-safe operation. Uses five queries in total (NPCs + four bulk related-data
+     * queries grouped by npc_id), independent of NPC count.
      */
     void loadNPCs();
 
+    /**
+     * @brief Force a fresh load even if NPCs are already in memory
+     * The previous snapshot stays visible to readers until the new one is swapped in.
+     */
+    void reloadNPCs();
+
     /**
      * @brief Get all NPCs as map (thread-safe)
      * @return Map of NPC ID to NPCDataStruct
@@ -80,40 +87,47 @@ class NPCManager
 
     // Thread-safe storage for NPCs
     mutable std::mutex npcsMutex_;
+    /// Serialises loadNPCs() callers; npcsMutex_ is only held to check loaded_ and swap in the result
+    std::mutex loadMutex_;
     std::map<int, NPCDataStruct> npcs_;
     bool loaded_ = false;
 
     /**
-     * @brief Load NPC attributes from database
+     * @brief Query NPCs and their related data and swap them in; caller holds loadMutex_
+     */
+    void loadNPCsLocked();
+
+    /**
+     * @brief Attach attributes of every NPC (one query, grouped by npc_id)
      * @param transaction Database transaction
-     * @param npcId NPC identifier
-     * @return Vector of NPC attributes
+     * @param npcs NPCs being loaded, keyed by NPC ID
+     * @return Number of attribute rows attached
      */
-    std::vector<NPCAttributeStruct> loadNPCAttributes(pqxx::work &transaction, int npcId);
+    size_t loadAllNPCAttributes(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs);
 
     /**
-     * @brief Load NPC skills from database
+     * @brief Attach skills of every NPC (one query, grouped by npc_id)
      * @param transaction Database transaction
-     * @param npcId NPC identifier
-     * @return Vector of NPC skills
+     * @param npcs NPCs being loaded, keyed by NPC ID
+     * @return Number of skill rows attached
      */
-    std::vector<SkillStruct> loadNPCSkills(pqxx::work &transaction, int npcId);
+    size_t loadAllNPCSkills(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs);
 
     /**
-     * @brief Load NPC position from database
+     * @brief Fill position and zoneId of every NPC (one query, grouped by npc_id)
      * @param transaction Database transaction
-     * @param npcId NPC identifier
-     * @return PositionStruct with NPC coordinates
+     * @param npcs NPCs being loaded, keyed by NPC ID
+     * @return Number of position rows applied
      */
-    PositionStruct loadNPCPosition(pqxx::work &transaction, int npcId, int &zoneId);
+    size_t loadAllNPCPositions(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs);
 
     /**
-     * @brief Load quest slugs for which this NPC is the giver or turn-in target.
+     * @brief Attach quest slugs for which each NPC is the giver or turn-in target (one query)
      * @param transaction Database transaction
-     * @param npcId NPC identifier
-     * @return Vector of quest slug strings
+     * @param npcs NPCs being loaded, keyed by NPC ID
+     * @return Number of quest rows attached
      */
-    std::vector<std::string> loadNPCQuests(pqxx::work &transaction, int npcId);
+    size_t loadAllNPCQuests(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs);
 
     /**
      * @brief Calculate max health from attributes
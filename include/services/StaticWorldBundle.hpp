@@ -0,0 +1,102 @@
+#pragma once
+#include "network/WireCodec.hpp"
+#include "utils/Logger.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Versioned cache of the static world data sent to every chunk server on join.
+ *
+ * Spawn zones, mobs, NPCs, items, loot, quests, templates, etc. are built once and
+ * kept as serialized bodies plus their envelope headers, then replayed to each
+ * joining chunk server. Each send gets a fresh header timestamp, and the header
+ * clientId is replaced per receiver.
+ *
+ * The cache is dropped explicitly with invalidate() whenever the underlying data is
+ * reloaded; the next join rebuilds it. Concurrent joins wait for a single build.
+ */
+class StaticWorldBundle
+{
+  public:
+    /// One response as produced by NetworkManager::generateResponseMessage(), split into its envelope parts.
+    struct Message
+    {
+        std::string body;      ///< serialized "body" value
+        nlohmann::json header; ///< envelope header, without its timestamp (stamped per send)
+        bool patchClientId = false; ///< header clientId is the builder's and is replaced per receiver
+        bool isError = false;
+    };
+
+    using PreparedMessages = std::vector<WireCodec::PreparedEnvelope>;
+
+    struct Snapshot
+    {
+        uint64_t version = 0;
+        std::vector<Message> messages;
+        std::size_t totalBytes = 0;
+
+        /// Binary encodings of messages, built on first use per wire format (see prepared())
+        mutable std::mutex preparedMutex;
+        mutable std::array<std::shared_ptr<const PreparedMessages>, 3> prepared;
+    };
+
+    /// Fills the message list; returns false when any part of the bundle failed to build.
+    using Builder = std::function<bool(std::vector<Message> &)>;
+
+    explicit StaticWorldBundle(Logger &logger);
+
+    /**
+     * @brief Return the cached snapshot, building it with @p builder when missing.
+     * A snapshot that failed to build or was invalidated while building is still
+     * returned to the caller, but it is not cached.
+     */
+    std::shared_ptr<const Snapshot> getOrBuild(const Builder &builder);
+
+    /**
+     * @brief Drop the cached snapshot so the next join rebuilds it.
+     * @return The new bundle version
+     */
+    uint64_t invalidate(const std::string &reason);
+
+    uint64_t getVersion() const;
+
+    /**
+     * @brief Split a serialized response into body and header.
+     * The header clientId is replaced per receiver only when it is @p clientId (the builder's);
+     * responses carrying another clientId are replayed unchanged.
+     */
+    static Message makeMessage(const std::string &data, int clientId);
+
+    /// Render the {"body":..,"header":..} envelope of @p message for a receiver.
+    static std::string render(const Message &message, int clientId);
+
+    /**
+     * @brief Bodies of every message of @p snapshot pre-encoded in a binary @p format.
+     * Built once per snapshot and format, so replaying the bundle to binary peers
+     * only encodes the small headers.
+     */
+    static std::shared_ptr<const PreparedMessages> prepared(const Snapshot &snapshot, WireFormat format);
+
+    /// Binary counterpart of render(): a complete frame for the receiver
+    static std::string renderFrame(const Message &message,
+        const WireCodec::PreparedEnvelope &prepared,
+        WireFormat format,
+        int clientId);
+
+  private:
+    Logger &logger_;
+    std::shared_ptr<spdlog::logger> log_;
+
+    /// Guards snapshot_ and version_; never held while building
+    mutable std::mutex mutex_;
+    /// Serialises builds so simultaneous joins do not all hit the database
+    std::mutex buildMutex_;
+    std::shared_ptr<const Snapshot> snapshot_;
+    uint64_t version_ = 1;
+};
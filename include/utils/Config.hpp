@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdlib>
 #include <string>
 #include <tuple>
@@ -10,12 +11,23 @@ struct DatabaseConfig {
     std::string password;
     std::string host;
     short port;
+    int pool_size;
 };
 
 struct GameServerConfig {
     std::string host;
     short port;
     short max_clients;
+    size_t max_write_batch_bytes; ///< cap on bytes gathered into one socket write
+    size_t write_high_watermark;  ///< per-socket queued bytes that trigger the slow-consumer policy
+    size_t write_low_watermark;   ///< per-socket queued bytes at which a paused peer is resumed
+    size_t write_hard_limit;      ///< per-socket queued bytes at which the default policy disconnects
+    int character_flush_interval_sec; ///< period of the write-behind character state flush
+    int inventory_flush_interval_sec; ///< period of the write-behind inventory item flush
+    size_t analytics_flush_rows;        ///< buffered analytics rows that trigger a COPY
+    int analytics_flush_interval_ms;    ///< longest an analytics row waits before a COPY
+    size_t analytics_max_buffer_bytes;  ///< memory bound of the analytics buffer
+    std::string analytics_spill_path;   ///< overflow file for analytics rows; empty drops the oldest
 };
 
 class Config {
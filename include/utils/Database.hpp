@@ -3,11 +3,18 @@
 
 #include "utils/Config.hpp"
 #include "utils/Logger.hpp"
+#include <array>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <pqxx/pqxx>
+#include <string>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
 class Database
 {
@@ -15,38 +22,59 @@ class Database
     // Constructor
     Database(std::tuple<DatabaseConfig, GameServerConfig> &configs, Logger &logger);
 
-    // Establish a database connection
+    // Establish the pooled database connections
     void connect(std::tuple<DatabaseConfig, GameServerConfig> &configs);
 
-    // Prepare default queries
-    void prepareDefaultQueries();
+    // Prepare default queries on a single pooled connection
+    void prepareDefaultQueries(pqxx::connection &conn);
 
-    /// CRITICAL-6 fix: RAII wrapper that holds the DB mutex for the lifetime of a transaction.
+    /// CRITICAL-6 fix: RAII wrapper that owns one pooled connection for the lifetime of a transaction.
+    /// The connection is returned to the pool when the wrapper goes out of scope.
     /// Usage:
     ///   auto sc = db.getConnectionLocked();
     ///   pqxx::work txn(sc.get());
     ///   ...
-    ///   txn.commit();  // sc goes out of scope — mutex released
+    ///   txn.commit();  // sc goes out of scope — connection checked back in
     struct ScopedConnection
     {
-        std::unique_lock<std::mutex> lock;
-        pqxx::connection &conn;
-        /// Construct by locking mutex from scratch (original path)
-        ScopedConnection(std::mutex &m, pqxx::connection &c) : lock(m), conn(c) {}
-        /// Construct with an already-owned lock (HIGH-10 reconnect path)
-        ScopedConnection(std::unique_lock<std::mutex> l, pqxx::connection &c) : lock(std::move(l)), conn(c) {}
-        ScopedConnection(ScopedConnection &&) = default;
+        ScopedConnection(Database &owner, std::size_t slot, pqxx::connection &c)
+            : owner_(&owner), slot_(slot), conn_(&c) {}
+        ScopedConnection(ScopedConnection &&other) noexcept
+            : owner_(other.owner_), slot_(other.slot_), conn_(other.conn_)
+        {
+            other.owner_ = nullptr;
+        }
+        ScopedConnection(const ScopedConnection &) = delete;
+        ScopedConnection &operator=(const ScopedConnection &) = delete;
+        ScopedConnection &operator=(ScopedConnection &&) = delete;
+        ~ScopedConnection()
+        {
+            if (owner_)
+                owner_->releaseConnection(slot_);
+        }
         pqxx::connection &get()
         {
-            return conn;
+            return *conn_;
         }
+
+      private:
+        Database *owner_;
+        std::size_t slot_;
+        pqxx::connection *conn_;
     };
+    /// Checks out a free connection, blocking while every pooled connection is in use.
     ScopedConnection getConnectionLocked();
 
     /// Legacy accessor — NOT thread-safe when used directly for transactions.
-    /// Kept for prepareDefaultQueries() which runs single-threaded at startup.
+    /// Returns the first pooled connection without checking it out.
     pqxx::connection &getConnection();
 
+    /// Number of connections in the pool (DB_POOL_SIZE).
+    std::size_t getPoolSize() const
+    {
+        return connections_.size();
+    }
+
     // Handle database connection or query errors
     void handleDatabaseError(const std::exception &e);
     // Execute a query with a transaction
@@ -56,15 +84,42 @@ class Database
         const std::vector<std::variant<int, int64_t, float, double, std::string>> &parameters);
 
   private:
-    // Database connection
-    std::unique_ptr<pqxx::connection> connection_;
+    /// Returns a checked-out slot to the free list and wakes one waiter.
+    void releaseConnection(std::size_t slot);
+
+    // Pooled connections; a slot may hold nullptr until its first successful (re)connect
+    std::vector<std::unique_ptr<pqxx::connection>> connections_;
+    /// Indices of connections_ that are not currently checked out
+    std::vector<std::size_t> freeSlots_;
     /// HIGH-10: connection string stored so getConnectionLocked() can reconnect
     std::string connectionString_;
-    /// CRITICAL-6: serialises concurrent pqxx::work transactions on the single connection
-    mutable std::mutex dbMutex_;
+    /// CRITICAL-6: guards freeSlots_; each pqxx::work runs on its own checked-out connection
+    std::mutex poolMutex_;
+    std::condition_variable poolCv_;
     // Logger
     Logger &logger_;
     std::shared_ptr<spdlog::logger> log_;
 };
 
+// Renders values as a PostgreSQL array literal ("{1,2,3}") for unnest()-based bulk statements.
+// std::to_chars gives the shortest text that reads back to the same value and ignores the
+// locale; std::to_string would cut floats to six decimals and could use a decimal comma.
+template <typename T>
+std::string
+toPgArrayLiteral(const std::vector<T> &values)
+{
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "toPgArrayLiteral renders numbers");
+    std::string out = "{";
+    std::array<char, 32> buffer;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (i > 0)
+            out += ',';
+        const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), values[i]);
+        out.append(buffer.data(), result.ptr);
+    }
+    out += '}';
+    return out;
+}
+
 #endif // DATABASE_HPP
@@ -9,6 +9,7 @@ class JSONParser
     JSONParser();
     ~JSONParser();
 
+    // Raw-buffer entry points: parse the buffer, then delegate to the document overloads below.
     CharacterDataStruct parseCharacterData(const char *data, size_t length);
     PositionStruct parsePositionData(const char *data, size_t length);
     ClientDataStruct parseClientData(const char *data, size_t length);
@@ -18,4 +19,15 @@ class JSONParser
     nlohmann::json parseCharactersList(const char *data, size_t length);
     std::vector<CharacterDataStruct> parseSavePositionsData(const char *data, size_t length);
     std::vector<CharacterDataStruct> parseSaveCharacterProgressData(const char *data, size_t length);
+
+    // Document overloads: extract from an already-parsed message so one parse can feed every struct.
+    CharacterDataStruct parseCharacterData(const nlohmann::json &jsonData);
+    PositionStruct parsePositionData(const nlohmann::json &jsonData);
+    ClientDataStruct parseClientData(const nlohmann::json &jsonData);
+    MessageStruct parseMessage(const nlohmann::json &jsonData);
+    std::string parseEventType(const nlohmann::json &jsonData);
+    ChunkInfoStruct parseChunkServerHandshakeData(const nlohmann::json &jsonData);
+    nlohmann::json parseCharactersList(const nlohmann::json &jsonData);
+    std::vector<CharacterDataStruct> parseSavePositionsData(const nlohmann::json &jsonData);
+    std::vector<CharacterDataStruct> parseSaveCharacterProgressData(const nlohmann::json &jsonData);
 };
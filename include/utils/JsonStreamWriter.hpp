@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+struct TimestampStruct;
+
+/**
+ * @brief Appends JSON text straight into a string, without building a DOM.
+ *
+ * Used for the large catalog responses (mobs, items, NPCs, world objects), where
+ * building one nlohmann::json per row and copying the array into the envelope cost
+ * several full copies of a multi-megabyte payload. Output is compact and escaped
+ * exactly like nlohmann::json::dump(); keys are written in call order.
+ *
+ *     writer.beginObject().field("id", 1).field("name", name).endObject();
+ */
+class JsonStreamWriter
+{
+  public:
+    explicit JsonStreamWriter(std::string &out) : out_(out) {}
+
+    JsonStreamWriter &beginObject();
+    JsonStreamWriter &endObject();
+    JsonStreamWriter &beginArray();
+    JsonStreamWriter &endArray();
+    JsonStreamWriter &key(std::string_view name);
+
+    JsonStreamWriter &value(std::string_view text);
+    JsonStreamWriter &value(const std::string &text) { return value(std::string_view(text)); }
+    JsonStreamWriter &value(const char *text) { return value(std::string_view(text)); }
+    JsonStreamWriter &value(bool flag);
+    JsonStreamWriter &value(std::nullptr_t);
+    JsonStreamWriter &value(double number);
+    /// Embed an already built value (small nested documents)
+    JsonStreamWriter &value(const nlohmann::json &json);
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    JsonStreamWriter &value(T number)
+    {
+        separate();
+        appendInteger(static_cast<std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>>(number));
+        return *this;
+    }
+
+    JsonStreamWriter &value(float number) { return value(static_cast<double>(number)); }
+
+    template <typename T>
+    JsonStreamWriter &field(std::string_view name, const T &fieldValue)
+    {
+        key(name);
+        return value(fieldValue);
+    }
+
+    /// "name": [ ...items ] for any iterable of scalars
+    template <typename Range>
+    JsonStreamWriter &arrayField(std::string_view name, const Range &items)
+    {
+        key(name);
+        beginArray();
+        for (const auto &item : items)
+            value(item);
+        return endArray();
+    }
+
+  private:
+    void separate();
+    void appendInteger(long long number);
+    void appendInteger(unsigned long long number);
+    void appendEscaped(std::string_view text);
+
+    std::string &out_;
+    bool needComma_ = false;
+};
+
+/**
+ * @brief Write the envelope "header" key and object: the caller's @p header fields, then
+ * status, timestamp and version, plus the lag-compensation fields when @p timestamps is
+ * set. Caller fields the envelope sets itself are skipped so they are never duplicated.
+ */
+void writeEnvelopeHeader(JsonStreamWriter &writer,
+    std::string_view status,
+    const nlohmann::json *header,
+    const TimestampStruct *timestamps = nullptr);
+
+/// The same header as a JSON object, for envelopes encoded in a binary wire format
+nlohmann::json makeEnvelopeHeader(std::string_view status,
+    const nlohmann::json *header,
+    const TimestampStruct *timestamps = nullptr);
+
+/**
+ * @brief A response envelope streamed straight into its frame buffer.
+ *
+ * The body is written first through body(); finish() appends the header and the
+ * frame newline. Produces the same envelope as NetworkManager::generateResponseMessage(),
+ * so the result can be sent or cached in the static world bundle like any other response.
+ */
+class ResponseStream
+{
+  public:
+    ResponseStream();
+
+    ResponseStream(const ResponseStream &) = delete;
+    ResponseStream &operator=(const ResponseStream &) = delete;
+
+    /// Writer positioned inside the "body" object
+    JsonStreamWriter &body() { return writer_; }
+
+    /// Close the body and append the envelope header built from @p header (see writeEnvelopeHeader()).
+    /// The text is moved out, not copied; the stream is spent afterwards.
+    std::string finish(std::string_view status, const nlohmann::json &header);
+
+  private:
+    std::string buffer_;
+    JsonStreamWriter writer_;
+};
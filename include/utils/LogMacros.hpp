@@ -0,0 +1,86 @@
+#pragma once
+
+#include "utils/Logger.hpp"
+#include <atomic>
+#include <cstdint>
+#include <spdlog/logger.h>
+
+/**
+ * Level-gated logging for hot paths.
+ *
+ * log_->debug("x=" + std::to_string(x)) builds its string (and runs whatever the
+ * arguments call) before spdlog looks at the level. These macros check the level
+ * first, so the format arguments are only evaluated when the message is emitted:
+ *
+ *     GS_LOG_DEBUG(log_, "Sent {} bytes to {}", bytes, describePeer(socket));
+ *
+ * Levels below GS_LOG_ACTIVE_LEVEL are removed at compile time. It defaults to
+ * info when NDEBUG is set (Release builds) and to trace otherwise; override with
+ * -DGS_LOG_ACTIVE_LEVEL=SPDLOG_LEVEL_xxx.
+ *
+ * GS_LOG_SAMPLED emits one in N messages of a call site. N is the default given at
+ * the call site unless LOG_SAMPLE_<SYSTEM> (e.g. LOG_SAMPLE_EVENTS=1000) overrides
+ * it for the logger's system; 1 logs every message.
+ */
+
+#ifndef GS_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define GS_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#else
+#define GS_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+#endif
+
+#define GS_LOG_AT(logger, level, ...)                 \
+    do                                                \
+    {                                                 \
+        auto &gsLogger_ = (logger);                   \
+        if (gsLogger_->should_log(level))             \
+            gsLogger_->log(level, __VA_ARGS__);       \
+    } while (0)
+
+#define GS_LOG_SAMPLED_AT(logger, level, every, ...)                                             \
+    do                                                                                           \
+    {                                                                                            \
+        auto &gsLogger_ = (logger);                                                              \
+        if (gsLogger_->should_log(level))                                                        \
+        {                                                                                        \
+            static const std::uint32_t gsEvery_ = Logger::sampleRate(gsLogger_->name(), every);  \
+            static std::atomic<std::uint32_t> gsCount_{0};                                       \
+            if (gsCount_.fetch_add(1, std::memory_order_relaxed) % gsEvery_ == 0)                \
+                gsLogger_->log(level, __VA_ARGS__);                                              \
+        }                                                                                        \
+    } while (0)
+
+// Compiled out, but the arguments stay type-checked and count as used; never evaluated
+#define GS_LOG_STRIPPED(logger, level, ...)                \
+    do                                                     \
+    {                                                      \
+        if (false)                                         \
+            GS_LOG_AT(logger, level, __VA_ARGS__);         \
+    } while (0)
+
+#if GS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define GS_LOG_TRACE(logger, ...) GS_LOG_AT(logger, spdlog::level::trace, __VA_ARGS__)
+#else
+#define GS_LOG_TRACE(logger, ...) GS_LOG_STRIPPED(logger, spdlog::level::trace, __VA_ARGS__)
+#endif
+
+#if GS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define GS_LOG_DEBUG(logger, ...) GS_LOG_AT(logger, spdlog::level::debug, __VA_ARGS__)
+#define GS_LOG_DEBUG_SAMPLED(logger, every, ...) GS_LOG_SAMPLED_AT(logger, spdlog::level::debug, every, __VA_ARGS__)
+#else
+#define GS_LOG_DEBUG(logger, ...) GS_LOG_STRIPPED(logger, spdlog::level::debug, __VA_ARGS__)
+#define GS_LOG_DEBUG_SAMPLED(logger, every, ...) GS_LOG_STRIPPED(logger, spdlog::level::debug, __VA_ARGS__)
+#endif
+
+#if GS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define GS_LOG_INFO(logger, ...) GS_LOG_AT(logger, spdlog::level::info, __VA_ARGS__)
+#define GS_LOG_INFO_SAMPLED(logger, every, ...) GS_LOG_SAMPLED_AT(logger, spdlog::level::info, every, __VA_ARGS__)
+#else
+#define GS_LOG_INFO(logger, ...) GS_LOG_STRIPPED(logger, spdlog::level::info, __VA_ARGS__)
+#define GS_LOG_INFO_SAMPLED(logger, every, ...) GS_LOG_STRIPPED(logger, spdlog::level::info, __VA_ARGS__)
+#endif
+
+#define GS_LOG_WARN(logger, ...) GS_LOG_AT(logger, spdlog::level::warn, __VA_ARGS__)
+#define GS_LOG_ERROR(logger, ...) GS_LOG_AT(logger, spdlog::level::err, __VA_ARGS__)
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "utils/TerminalColors.hpp" // kept for backward-compat (callers pass color consts, we ignore them)
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 // Forward declaration — spdlog headers are only in Logger.cpp, not pulled into every TU
 namespace spdlog
@@ -40,6 +42,10 @@ class Logger
     //        log->debug("Player {} hit mob {}", playerId, mobId);
     std::shared_ptr<spdlog::logger> getSystem(const std::string &system);
 
+    // Sampling rate for GS_LOG_*_SAMPLED call sites (see utils/LogMacros.hpp): the
+    // LOG_SAMPLE_<UPPER(system)> env var for logger "<server>.<system>", else defaultEvery.
+    static std::uint32_t sampleRate(std::string_view loggerName, std::uint32_t defaultEvery);
+
   private:
     std::string serverName_;
     std::shared_ptr<spdlog::logger> logger_;
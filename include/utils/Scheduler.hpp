@@ -1,42 +1,129 @@
 #pragma once
 
-#include <functional>
-#include <queue>
-#include <vector>
-#include <mutex>
-#include <condition_variable>
-#include <chrono>
-#include <atomic>
-#include <algorithm>
 #include "data/SpecialStructs.hpp"
+#include "utils/Logger.hpp"
+#include "utils/ThreadPool.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <thread>
+#include <unordered_map>
 
-// Компаратор для min-heap (задача с меньшим nextRunTime имеет больший приоритет)
-struct TaskComparator {
-    bool operator()(const Task &a, const Task &b) const {
-        return a.nextRunTime > b.nextRunTime;
-    }
-};
+/**
+ * @brief Hierarchical timing wheel on steady_clock with 1 ms ticks.
+ *
+ * Four wheels of 256/64/64/64 slots cover 256 ms, ~16 s, ~17 min and ~18.6 h;
+ * a timer sits in the coarsest wheel its delay needs and is cascaded into finer
+ * ones as its slot comes up, so scheduling, cancelling and firing are O(1).
+ * Timers further out than the outer wheel are parked in its last slot and
+ * re-placed on every pass.
+ *
+ * Periodic tasks are fixed-rate: each run is anchored to startTime + n * interval,
+ * not to when the previous run happened, so they do not drift. Runs missed while
+ * the timer thread was stalled are skipped rather than replayed. An optional jitter
+ * delays each run by a random amount within [0, jitter] without moving the anchor.
+ *
+ * Callbacks run on the scheduler's own worker pool, never on the timer thread. A
+ * periodic task whose previous run has not finished skips that period instead of
+ * running twice concurrently.
+ */
+class Scheduler
+{
+  public:
+    /// Identifies one scheduled task; 0 is never returned
+    using TaskHandle = std::uint64_t;
 
-class Scheduler {
-public:
-    Scheduler();
+    explicit Scheduler(Logger &logger, std::size_t workerThreads = 2);
     ~Scheduler();
 
+    Scheduler(const Scheduler &) = delete;
+    Scheduler &operator=(const Scheduler &) = delete;
+
     void start();
+    /// Stops the timer thread and waits for callbacks that are already running
     void stop();
 
-    // Добавляем задачу в планировщик
-    void scheduleTask(const Task &task);
-    // Помечаем задачу для удаления (пересобираем кучу)
+    TaskHandle scheduleTask(Task task);
+    /// Cancel one task; a run already handed to the workers but not started is dropped
+    bool cancel(TaskHandle handle);
+    /// Cancel every task scheduled with @p id
     void removeTask(int id);
 
-private:
+  private:
+    static constexpr unsigned INNER_BITS = 8;
+    static constexpr unsigned OUTER_BITS = 6;
+    static constexpr std::size_t INNER_SLOTS = std::size_t(1) << INNER_BITS;
+    static constexpr std::size_t OUTER_SLOTS = std::size_t(1) << OUTER_BITS;
+    static constexpr std::size_t OUTER_LEVELS = 3;
+    /// Ticks covered by all wheels together (2^26 ms)
+    static constexpr std::uint64_t WHEEL_SPAN = std::uint64_t(1) << (INNER_BITS + OUTER_LEVELS * OUTER_BITS);
+
+    struct TaskState
+    {
+        std::function<void()> func;
+        int id = 0;
+        std::uint64_t interval = 0; ///< ms; 0 = run once
+        std::uint64_t jitter = 0;   ///< ms
+        std::atomic<bool> running{false};
+        std::atomic<bool> cancelled{false};
+    };
+
+    struct Entry
+    {
+        TaskHandle handle = 0;
+        std::uint64_t baseTick = 0;   ///< fixed-rate anchor of the next run
+        std::uint64_t expiryTick = 0; ///< baseTick plus this run's jitter
+        std::size_t level = 0;        ///< 0 = inner wheel
+        std::size_t slot = 0;
+        std::shared_ptr<TaskState> state;
+    };
+
+    using Bucket = std::list<Entry>;
+
     void run();
+    std::uint64_t nowTick() const;
+    std::uint64_t toTick(std::chrono::steady_clock::time_point time) const;
+    std::uint64_t jitterFor(const TaskState &state);
+
+    // The helpers below require mutex_ to be held
+    Bucket &bucket(std::size_t level, std::size_t slot);
+    /// Move @p it (from any list) into the slot for its expiryTick
+    void place(Bucket &from, Bucket::iterator it);
+    void cascade(std::size_t level);
+    void advanceTo(std::uint64_t tick);
+    std::uint64_t nextWakeTick() const;
+    void fire(Bucket &due, Bucket::iterator it);
+    bool cancelLocked(TaskHandle handle);
+    void forget(Bucket &from, Bucket::iterator it);
+    void dispatch(const std::shared_ptr<TaskState> &state);
+    void runTask(TaskState &state);
 
-    std::priority_queue<Task, std::vector<Task>, TaskComparator> tasksHeap;
-    std::mutex mutex;
-    std::condition_variable cv;
-    std::atomic<bool> stopFlag;
-    std::thread thread;
-};
\ No newline at end of file
+    std::shared_ptr<spdlog::logger> log_;
+    const std::chrono::steady_clock::time_point origin_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idleCv_;
+    bool stopFlag_ = false;
+    bool wakeUp_ = false;
+
+    std::uint64_t currentTick_ = 0; ///< last tick whose inner slot has been fired
+    std::array<Bucket, INNER_SLOTS> inner_;
+    std::array<std::array<Bucket, OUTER_SLOTS>, OUTER_LEVELS> outer_;
+    std::size_t outerCount_ = 0;
+
+    std::unordered_map<TaskHandle, Bucket::iterator> byHandle_;
+    std::unordered_multimap<int, TaskHandle> byTaskId_;
+    TaskHandle nextHandle_ = 1;
+    std::mt19937 rng_;
+
+    std::size_t inFlight_ = 0;
+    ThreadPool executor_;
+    std::thread thread_;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "utils/ThreadPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * Ordered execution lanes on top of ThreadPool.
+ *
+ * Every task is posted with a key (character id, client id, chunk socket, ...)
+ * and hashed to one of N lanes. Tasks in the same lane run one at a time in
+ * submission order; different lanes run in parallel on the pool. This gives
+ * per-key ordering (two saves for one character never overlap or reorder)
+ * without any global lock.
+ */
+class ShardedExecutor
+{
+  public:
+    using Key = std::uint64_t;
+
+    ShardedExecutor(ThreadPool &pool, std::size_t laneCount);
+
+    ShardedExecutor(const ShardedExecutor &) = delete;
+    ShardedExecutor &operator=(const ShardedExecutor &) = delete;
+
+    void post(Key key, PoolTask task);
+
+    /// Post many keyed tasks; lanes that become runnable are handed to the pool in one batch
+    void postBatch(std::vector<std::pair<Key, PoolTask>> &&tasks);
+
+    std::size_t laneCount() const { return lanes_.size(); }
+
+  private:
+    struct alignas(64) Lane
+    {
+        std::mutex mutex;
+        std::deque<PoolTask> tasks;
+        bool scheduled = false; ///< a drain task for this lane is queued or running
+    };
+
+    /// Max tasks a lane runs before yielding its worker back to the pool
+    static constexpr std::size_t DRAIN_BUDGET = 32;
+
+    Lane &laneFor(Key key);
+    PoolTask makeDrainTask(Lane &lane);
+    void drain(Lane &lane);
+    /// After a drain stopped with its lane still scheduled: queue another drain, or mark the lane idle
+    void handOn(Lane &lane);
+
+    ThreadPool &pool_;
+    std::vector<std::unique_ptr<Lane>> lanes_;
+};
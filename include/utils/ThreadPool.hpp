@@ -1,14 +1,139 @@
 #pragma once
 
-#include <vector>
-#include <queue>
-#include <thread>
-#include <mutex>
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Move-only callable with small-buffer storage.
+ *
+ * Callables up to INLINE_SIZE bytes (e.g. a lambda capturing `this`, a shared_ptr
+ * and an index) are stored in place, so enqueueing them does not allocate the way
+ * std::function does. Larger callables fall back to a single heap allocation.
+ */
+class PoolTask
+{
+  public:
+    static constexpr std::size_t INLINE_SIZE = 48;
+
+    PoolTask() noexcept = default;
+
+    template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, PoolTask>>>
+    PoolTask(F &&f)
+    {
+        using Fn = std::decay_t<F>;
+        if constexpr (sizeof(Fn) <= INLINE_SIZE && alignof(Fn) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible_v<Fn>)
+        {
+            new (&storage_) Fn(std::forward<F>(f));
+            ops_ = &inlineOps<Fn>;
+        }
+        else
+        {
+            *reinterpret_cast<Fn **>(&storage_) = new Fn(std::forward<F>(f));
+            ops_ = &heapOps<Fn>;
+        }
+    }
+
+    PoolTask(PoolTask &&other) noexcept
+    {
+        moveFrom(other);
+    }
+
+    PoolTask &operator=(PoolTask &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    PoolTask(const PoolTask &) = delete;
+    PoolTask &operator=(const PoolTask &) = delete;
+
+    ~PoolTask()
+    {
+        reset();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return ops_ != nullptr;
+    }
+
+    void operator()()
+    {
+        ops_->invoke(&storage_);
+    }
+
+  private:
+    struct Ops
+    {
+        void (*invoke)(void *);
+        void (*move)(void *dst, void *src) noexcept;
+        void (*destroy)(void *) noexcept;
+    };
+
+    template <class Fn>
+    static constexpr Ops inlineOps{
+        [](void *p) { (*static_cast<Fn *>(p))(); },
+        [](void *dst, void *src) noexcept
+        {
+            new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            static_cast<Fn *>(src)->~Fn();
+        },
+        [](void *p) noexcept { static_cast<Fn *>(p)->~Fn(); }};
+
+    template <class Fn>
+    static constexpr Ops heapOps{
+        [](void *p) { (**static_cast<Fn **>(p))(); },
+        [](void *dst, void *src) noexcept { *static_cast<Fn **>(dst) = *static_cast<Fn **>(src); },
+        [](void *p) noexcept { delete *static_cast<Fn **>(p); }};
+
+    void moveFrom(PoolTask &other) noexcept
+    {
+        ops_ = other.ops_;
+        if (ops_)
+        {
+            ops_->move(&storage_, &other.storage_);
+            other.ops_ = nullptr;
+        }
+    }
+
+    void reset() noexcept
+    {
+        if (ops_)
+        {
+            ops_->destroy(&storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    std::aligned_storage_t<INLINE_SIZE, alignof(std::max_align_t)> storage_;
+    const Ops *ops_ = nullptr;
+};
 
+/**
+ * Work-stealing thread pool.
+ *
+ * Each worker owns a deque: it pushes/pops its own work at the back (LIFO, cache
+ * friendly) while idle workers steal from the front of other deques. Tasks
+ * submitted from outside the pool land in a shared injection queue, which
+ * enqueueBatch() fills under a single lock with a single wake-up.
+ */
 class ThreadPool
 {
 public:
@@ -16,7 +141,10 @@ public:
     ~ThreadPool();
 
     // Старая версия API – для задач без возвращаемого значения
-    void enqueueTask(std::function<void()> task);
+    void enqueueTask(PoolTask task);
+
+    /// Submit a whole batch with one synchronisation point
+    void enqueueBatch(std::vector<PoolTask> &&tasks);
 
     // Новая версия API – для задач с возвращаемым значением
     template <class F, class... Args>
@@ -27,23 +155,48 @@ public:
         auto task = std::make_shared<std::packaged_task<return_type()>>(
             std::bind(std::forward<F>(f), std::forward<Args>(args)...)
         );
-        
+
         std::future<return_type> res = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queueMutex);
-            if (stop)
-                throw std::runtime_error("enqueue on stopped ThreadPool");
-            tasks.push([task]() { (*task)(); });
-        }
-        condition.notify_one();
+        enqueueTask(PoolTask([task]() { (*task)(); }));
         return res;
     }
 
+    size_t size() const { return workers.size(); }
+
+    /// Block until every submitted task, including follow-ups it spawned, has finished.
+    /// Must not be called from a worker of this pool.
+    void waitIdle();
+
 private:
+    struct alignas(64) WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<PoolTask> tasks;
+    };
+
+    void workerLoop(size_t index);
+    bool popLocal(size_t index, PoolTask &task);
+    bool popInjected(size_t index, PoolTask &task);
+    bool steal(size_t index, PoolTask &task);
+    void wakeWorkers(size_t count);
+
     std::vector<std::thread> workers;
-    std::queue<std::function<void()>> tasks;
-    
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+
+    /// Tasks submitted from non-worker threads
+    std::mutex injectMutex_;
+    std::deque<PoolTask> injected_;
+
+    /// Number of queued (not yet started) tasks across all queues
+    std::atomic<size_t> pending_{0};
+    std::atomic<size_t> sleepers_{0};
+
+    /// Submitted but not yet finished tasks; a task's follow-ups are counted before it finishes
+    std::atomic<size_t> unfinished_{0};
+    std::mutex idleMutex_;
+    std::condition_variable idleCondition_;
+
     std::mutex queueMutex;
     std::condition_variable condition;
-    bool stop = false;
+    std::atomic<bool> stop{false};
 };
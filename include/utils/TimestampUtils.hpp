@@ -3,6 +3,7 @@
 #include <chrono>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
 
 /**
  * @brief Utility class for handling timestamp operations for lag compensation
@@ -22,6 +23,15 @@ class TimestampUtils
      */
     static std::string getCurrentTimestamp();
 
+    /**
+     * @brief Same as getCurrentTimestamp(), without allocating
+     *
+     * The text is cached per thread and re-formatted at most once per millisecond
+     * (the date/time part once per second).
+     * @return View valid until the next call on the same thread
+     */
+    static std::string_view getCurrentTimestampView();
+
     /**
      * @brief Set server receive timestamp to current time
      * @param timestamps Reference to TimestampStruct to update
@@ -53,12 +63,4 @@ class TimestampUtils
      * @return TimestampStruct with serverRecvMs set to current time
      */
     static TimestampStruct createTimestamp();
-
-    /**
-     * @brief Parse timestamps from message buffer
-     * @param messageBuffer Buffer containing the message
-     * @param messageLength Length of the message
-     * @return Parsed TimestampStruct
-     */
-    static TimestampStruct parseTimestampsFromBuffer(const std::array<char, 1024> &messageBuffer, size_t messageLength);
 };
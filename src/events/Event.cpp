@@ -1,17 +1,17 @@
 #include "events/Event.hpp"
 
-Event::Event(EventType type, int clientID, const EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket)
-    : type(type), clientID(clientID), eventData(data), currentClientSocket(clientSocket), hasTimestamps_(false)
+Event::Event(EventType type, int clientID, EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket)
+    : clientID(clientID), type(type), eventData(std::make_shared<const EventData>(std::move(data))), currentClientSocket(std::move(clientSocket)), hasTimestamps_(false)
 {
 }
 
-Event::Event(EventType type, int clientID, const EventData data, const TimestampStruct &timestamps)
-    : type(type), clientID(clientID), eventData(data), timestamps_(timestamps), hasTimestamps_(true)
+Event::Event(EventType type, int clientID, EventData data, const TimestampStruct &timestamps)
+    : clientID(clientID), type(type), eventData(std::make_shared<const EventData>(std::move(data))), timestamps_(timestamps), hasTimestamps_(true)
 {
 }
 
-Event::Event(EventType type, int clientID, const EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, const TimestampStruct &timestamps)
-    : type(type), clientID(clientID), eventData(data), currentClientSocket(clientSocket), timestamps_(timestamps), hasTimestamps_(true)
+Event::Event(EventType type, int clientID, EventData data, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, const TimestampStruct &timestamps)
+    : clientID(clientID), type(type), eventData(std::make_shared<const EventData>(std::move(data))), currentClientSocket(std::move(clientSocket)), timestamps_(timestamps), hasTimestamps_(true)
 {
 }
 
@@ -23,10 +23,12 @@ Event::getClientID() const
 }
 
 // Getter for data
-const EventData
+const EventData &
 Event::getData() const
 {
-    return eventData;
+    // Default-constructed events carry no payload
+    static const EventData emptyData;
+    return eventData ? *eventData : emptyData;
 }
 
 // Getter for type
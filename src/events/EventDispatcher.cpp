@@ -1,5 +1,29 @@
 #include "events/EventDispatcher.hpp"
+#include "utils/LogMacros.hpp"
 #include <spdlog/logger.h>
+#include <stdexcept>
+
+namespace
+{
+// The message is parsed exactly once by MessageHandler; handlers read from that shared document.
+const nlohmann::json &
+messageDocument(const EventPayload &payload)
+{
+    if (!payload.document)
+        throw std::runtime_error("payload carries no parsed document");
+    return *payload.document;
+}
+
+const nlohmann::json &
+messageBody(const EventPayload &payload)
+{
+    const auto &document = messageDocument(payload);
+    auto it = document.find("body");
+    if (it == document.end() || !it->is_object())
+        throw std::runtime_error("message has no body object");
+    return *it;
+}
+} // namespace
 
 EventDispatcher::EventDispatcher(
     EventQueue &eventQueue,
@@ -14,6 +38,68 @@ EventDispatcher::EventDispatcher(
       jsonParser_(jsonParser)
 {
     log_ = logger.getSystem("events");
+    buildRoutes();
+}
+
+void
+EventDispatcher::buildRoutes()
+{
+    // Keys are string literals, so the string_views stay valid for the dispatcher's lifetime
+    routes_ = {
+        {"joinGame",                  &EventDispatcher::handleJoinGame},
+        {"joinGameClient",            &EventDispatcher::handleJoinGame},
+        {"chunkServerConnection",     &EventDispatcher::handleChunkServerConnection},
+        {"moveCharacter",             &EventDispatcher::handleMoveCharacter},
+        {"disconnectClient",          &EventDispatcher::handleDisconnect},
+        {"pingClient",                &EventDispatcher::handlePing},
+        {"getSpawnZones",             &EventDispatcher::handleGetSpawnZones},
+        {"getMobData",                &EventDispatcher::handleGetMobData},
+        {"getCharacterExpForLevel",   &EventDispatcher::handleGetCharacterExpForLevel},
+        {"getExpLevelTable",          &EventDispatcher::handleGetExpLevelTable},
+        {"getNPCsData",               &EventDispatcher::handleGetNPCsData},
+        {"savePositions",             &EventDispatcher::handleSavePositions},
+        {"saveHpMana",                &EventDispatcher::handleSaveHpMana},
+        {"saveCharacterProgress",     &EventDispatcher::handleSaveCharacterProgress},
+        {"getPlayerQuests",           &EventDispatcher::handleGetPlayerQuests},
+        {"getPlayerFlags",            &EventDispatcher::handleGetPlayerFlags},
+        {"getPlayerActiveEffects",    &EventDispatcher::handleGetPlayerActiveEffects},
+        {"getCharacterAttributes",    &EventDispatcher::handleGetCharacterAttributesRefresh},
+        {"updatePlayerQuestProgress", &EventDispatcher::handleUpdatePlayerQuestProgress},
+        {"updatePlayerFlag",          &EventDispatcher::handleUpdatePlayerFlag},
+        {"saveInventoryChange",       &EventDispatcher::handleSaveInventoryChange},
+        {"getPlayerInventory",        &EventDispatcher::handleGetPlayerInventory},
+        {"saveEquipmentChange",       &EventDispatcher::handleSaveEquipmentChange},
+        {"saveExperienceDebt",        &EventDispatcher::handleSaveExperienceDebt},
+        {"saveActiveEffect",          &EventDispatcher::handleSaveActiveEffect},
+        {"saveDurabilityChange",      &EventDispatcher::handleSaveDurabilityChange},
+        {"saveItemKillCount",         &EventDispatcher::handleSaveItemKillCount},
+        {"transferInventoryItem",     &EventDispatcher::handleTransferInventoryItem},
+        {"nullifyItemOwner",          &EventDispatcher::handleNullifyItemOwner},
+        {"deleteInventoryItem",       &EventDispatcher::handleDeleteInventoryItem},
+        {"getPlayerPityData",         &EventDispatcher::handleGetPlayerPityData},
+        {"getPlayerBestiaryData",     &EventDispatcher::handleGetPlayerBestiaryData},
+        {"savePityCounter",           &EventDispatcher::handleSavePityCounter},
+        {"saveBestiaryKill",          &EventDispatcher::handleSaveBestiaryKill},
+        {"timedChampionKilled",       &EventDispatcher::handleTimedChampionKilled},
+        {"getPlayerReputationsData",  &EventDispatcher::handleGetPlayerReputationsData},
+        {"saveReputation",            &EventDispatcher::handleSaveReputation},
+        {"getPlayerMasteriesData",    &EventDispatcher::handleGetPlayerMasteriesData},
+        {"saveMastery",               &EventDispatcher::handleSaveMastery},
+        {"getMasteryDefinitionsData", &EventDispatcher::handleGetMasteryDefinitionsData},
+        {"saveLearnedSkill",          &EventDispatcher::handleSaveLearnedSkill},
+        {"saveSkillBarSlot",          &EventDispatcher::handleSaveSkillBarSlot},
+        {"getTitleDefinitionsData",   &EventDispatcher::handleGetTitleDefinitionsData},
+        {"getPlayerTitlesData",       &EventDispatcher::handleGetPlayerTitlesData},
+        {"getEmoteDefinitionsData",   &EventDispatcher::handleGetEmoteDefinitionsData},
+        {"getPlayerEmotesData",       &EventDispatcher::handleGetPlayerEmotesData},
+        {"savePlayerTitle",           &EventDispatcher::handleSavePlayerTitle},
+        {"saveSkillCooldown",         &EventDispatcher::handleSaveSkillCooldown},
+        {"getPlayerSkillCooldowns",   &EventDispatcher::handleGetPlayerSkillCooldowns},
+        {"analyticsEvent",            &EventDispatcher::handleSaveAnalyticsEvent},
+        {"savePlayTime",              &EventDispatcher::handleSavePlayTime},
+        {"markCharactersOnline",      &EventDispatcher::handleMarkCharactersOnline},
+        {"reloadStaticWorldData",     &EventDispatcher::handleReloadStaticWorldData},
+    };
 }
 
 void
@@ -21,225 +107,15 @@ EventDispatcher::dispatch(const std::string &eventType,
     const EventPayload &payload,
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
-    // CRITICAL-3 fix: eventsBatch_ is a shared member; serialise all dispatch() invocations
-    // so concurrent io_context threads cannot race on it.
-    std::lock_guard<std::mutex> dispatchLock(dispatchMutex_);
-
-    if (eventType == "joinGame" || eventType == "joinGameClient")
-    {
-        handleJoinGame(payload, socket);
-    }
-    else if (eventType == "chunkServerConnection")
-    {
-        handleChunkServerConnection(payload, socket);
-    }
-    else if (eventType == "moveCharacter")
-    {
-        handleMoveCharacter(payload, socket);
-    }
-    else if (eventType == "disconnectClient")
-    {
-        handleDisconnect(payload, socket);
-    }
-    else if (eventType == "pingClient")
-    {
-        handlePing(payload, socket);
-    }
-    else if (eventType == "getSpawnZones")
-    {
-        handleGetSpawnZones(payload, socket);
-    }
-    else if (eventType == "getMobData")
-    {
-        handleGetMobData(payload, socket);
-    }
-    else if (eventType == "getCharacterExpForLevel")
-    {
-        handleGetCharacterExpForLevel(payload, socket);
-    }
-    else if (eventType == "getExpLevelTable")
-    {
-        handleGetExpLevelTable(payload, socket);
-    }
-    else if (eventType == "getNPCsData")
-    {
-        handleGetNPCsData(payload, socket);
-    }
-    else if (eventType == "savePositions")
-    {
-        handleSavePositions(payload, socket);
-    }
-    else if (eventType == "saveHpMana")
-    {
-        handleSaveHpMana(payload, socket);
-    }
-    else if (eventType == "saveCharacterProgress")
-    {
-        handleSaveCharacterProgress(payload, socket);
-    }
-    else if (eventType == "getPlayerQuests")
-    {
-        handleGetPlayerQuests(payload, socket);
-    }
-    else if (eventType == "getPlayerFlags")
-    {
-        handleGetPlayerFlags(payload, socket);
-    }
-    else if (eventType == "getPlayerActiveEffects")
-    {
-        handleGetPlayerActiveEffects(payload, socket);
-    }
-    else if (eventType == "getCharacterAttributes")
-    {
-        handleGetCharacterAttributesRefresh(payload, socket);
-    }
-    else if (eventType == "updatePlayerQuestProgress")
-    {
-        handleUpdatePlayerQuestProgress(payload, socket);
-    }
-    else if (eventType == "updatePlayerFlag")
-    {
-        handleUpdatePlayerFlag(payload, socket);
-    }
-    else if (eventType == "saveInventoryChange")
-    {
-        handleSaveInventoryChange(payload, socket);
-    }
-    else if (eventType == "getPlayerInventory")
-    {
-        handleGetPlayerInventory(payload, socket);
-    }
-    else if (eventType == "saveEquipmentChange")
-    {
-        handleSaveEquipmentChange(payload, socket);
-    }
-    else if (eventType == "saveExperienceDebt")
-    {
-        handleSaveExperienceDebt(payload, socket);
-    }
-    else if (eventType == "saveActiveEffect")
-    {
-        handleSaveActiveEffect(payload, socket);
-    }
-    else if (eventType == "saveDurabilityChange")
-    {
-        handleSaveDurabilityChange(payload, socket);
-    }
-    else if (eventType == "saveItemKillCount")
-    {
-        handleSaveItemKillCount(payload, socket);
-    }
-    else if (eventType == "transferInventoryItem")
-    {
-        handleTransferInventoryItem(payload, socket);
-    }
-    else if (eventType == "nullifyItemOwner")
-    {
-        handleNullifyItemOwner(payload, socket);
-    }
-    else if (eventType == "deleteInventoryItem")
-    {
-        handleDeleteInventoryItem(payload, socket);
-    }
-    else if (eventType == "getPlayerPityData")
-    {
-        handleGetPlayerPityData(payload, socket);
-    }
-    else if (eventType == "getPlayerBestiaryData")
-    {
-        handleGetPlayerBestiaryData(payload, socket);
-    }
-    else if (eventType == "savePityCounter")
-    {
-        handleSavePityCounter(payload, socket);
-    }
-    else if (eventType == "saveBestiaryKill")
-    {
-        handleSaveBestiaryKill(payload, socket);
-    }
-    else if (eventType == "timedChampionKilled")
-    {
-        handleTimedChampionKilled(payload, socket);
-    }
-    else if (eventType == "getPlayerReputationsData")
-    {
-        handleGetPlayerReputationsData(payload, socket);
-    }
-    else if (eventType == "saveReputation")
-    {
-        handleSaveReputation(payload, socket);
-    }
-    else if (eventType == "getPlayerMasteriesData")
-    {
-        handleGetPlayerMasteriesData(payload, socket);
-    }
-    else if (eventType == "saveMastery")
-    {
-        handleSaveMastery(payload, socket);
-    }
-    else if (eventType == "getMasteryDefinitionsData")
-    {
-        handleGetMasteryDefinitionsData(payload, socket);
-    }
-    else if (eventType == "saveLearnedSkill")
-    {
-        handleSaveLearnedSkill(payload, socket);
-    }
-    else if (eventType == "saveSkillBarSlot")
-    {
-        handleSaveSkillBarSlot(payload, socket);
-    }
-    else if (eventType == "getTitleDefinitionsData")
-    {
-        handleGetTitleDefinitionsData(payload, socket);
-    }
-    else if (eventType == "getPlayerTitlesData")
-    {
-        handleGetPlayerTitlesData(payload, socket);
-    }
-    else if (eventType == "getEmoteDefinitionsData")
-    {
-        handleGetEmoteDefinitionsData(payload, socket);
-    }
-    else if (eventType == "getPlayerEmotesData")
-    {
-        handleGetPlayerEmotesData(payload, socket);
-    }
-    else if (eventType == "savePlayerTitle")
-    {
-        handleSavePlayerTitle(payload, socket);
-    }
-    else if (eventType == "saveSkillCooldown")
-    {
-        handleSaveSkillCooldown(payload, socket);
-    }
-    else if (eventType == "getPlayerSkillCooldowns")
-    {
-        handleGetPlayerSkillCooldowns(payload, socket);
-    }
-    else if (eventType == "analyticsEvent")
-    {
-        handleSaveAnalyticsEvent(payload, socket);
-    }
-    else if (eventType == "savePlayTime")
-    {
-        handleSavePlayTime(payload, socket);
-    }
-    else if (eventType == "markCharactersOnline")
-    {
-        handleMarkCharactersOnline(payload, socket);
-    }
-    else
+    // routes_ is immutable after construction and every handler pushes straight into the
+    // (internally synchronised) event queue, so concurrent io_context threads need no lock here.
+    auto it = routes_.find(std::string_view(eventType));
+    if (it == routes_.end())
     {
         log_->error("Unknown event type: " + eventType);
+        return;
     }
-
-    // Push batched events at the end
-    if (!eventsBatch_.empty())
-    {
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
-    }
+    (this->*(it->second))(payload, std::move(socket));
 }
 
 void
@@ -248,12 +124,7 @@ EventDispatcher::handleJoinGame(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event joinEvent(Event::JOIN_PLAYER_CLIENT, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(joinEvent);
-    // if (eventsBatch_.size() >= BATCH_SIZE)
-    //{
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
-    //}
+    eventQueue_.push(std::move(joinEvent));
 }
 
 void
@@ -262,12 +133,7 @@ EventDispatcher::handleMoveCharacter(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event moveEvent(Event::MOVE_CHARACTER, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(moveEvent);
-    if (eventsBatch_.size() >= BATCH_SIZE)
-    {
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
-    }
+    eventQueue_.push(std::move(moveEvent));
 }
 
 void
@@ -279,11 +145,9 @@ EventDispatcher::handleDisconnect(
     CharacterDataStruct charDataWithPos = payload.characterData;
     charDataWithPos.characterPosition = payload.positionData;
 
-    Event disconnectEvent(Event::DISCONNECT_CLIENT, payload.clientData.clientId, charDataWithPos, socket);
+    Event disconnectEvent(Event::DISCONNECT_CLIENT, payload.clientData.clientId, std::move(charDataWithPos), socket);
 
-    eventsBatch_.push_back(disconnectEvent);
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(disconnectEvent));
 }
 
 void
@@ -298,13 +162,7 @@ EventDispatcher::handleGetSpawnZones(
     }
 
     Event getSpawnZonesEvent(Event::SPAWN_MOBS_IN_ZONE, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(getSpawnZonesEvent);
-
-    // if (eventsBatch_.size() >= BATCH_SIZE)
-    //{
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
-    //}
+    eventQueue_.push(std::move(getSpawnZonesEvent));
 }
 
 void
@@ -313,10 +171,7 @@ EventDispatcher::handleChunkServerConnection(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event chunkServerConnectionEvent(Event::JOIN_CHUNK_SERVER, payload.chunkData.id, payload.chunkData, socket);
-    eventsBatch_.push_back(chunkServerConnectionEvent);
-
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(chunkServerConnectionEvent));
 }
 
 void
@@ -325,13 +180,7 @@ EventDispatcher::handleGetMobData(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event getMobDataEvent(Event::GET_MOB_DATA, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(getMobDataEvent);
-
-    // if (eventsBatch_.size() >= BATCH_SIZE)
-    //{
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
-    //}
+    eventQueue_.push(std::move(getMobDataEvent));
 }
 
 void
@@ -340,10 +189,7 @@ EventDispatcher::handleGetCharacterExpForLevel(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event getCharacterExpForLevelEvent(Event::GET_CHARACTER_EXP_FOR_LEVEL, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(getCharacterExpForLevelEvent);
-
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(getCharacterExpForLevelEvent));
 }
 
 void
@@ -352,10 +198,7 @@ EventDispatcher::handleGetExpLevelTable(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event getExpLevelTableEvent(Event::GET_EXP_LEVEL_TABLE, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(getExpLevelTableEvent);
-
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(getExpLevelTableEvent));
 }
 
 void
@@ -364,9 +207,9 @@ EventDispatcher::handlePing(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event pingEvent(Event::PING_CLIENT, payload.clientData.clientId, payload.clientData, socket);
-    eventQueuePing_.push(pingEvent);
+    eventQueuePing_.push(std::move(pingEvent));
 
-    log_->info("Ping event dispatched for client " + std::to_string(payload.clientData.clientId));
+    GS_LOG_DEBUG_SAMPLED(log_, 100, "Ping event dispatched for client {}", payload.clientData.clientId);
 }
 
 void
@@ -374,7 +217,7 @@ EventDispatcher::dispatchPingDirectly(const Event &pingEvent)
 {
     eventQueuePing_.push(pingEvent);
 
-    logger_.log("Ping event with timestamps dispatched for client " + std::to_string(pingEvent.getClientID()), GREEN);
+    GS_LOG_DEBUG_SAMPLED(log_, 100, "Ping event with timestamps dispatched for client {}", pingEvent.getClientID());
 }
 
 void
@@ -383,7 +226,7 @@ EventDispatcher::handleGetNPCsData(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event getNPCsDataEvent(Event::GET_NPCS_LIST, payload.clientData.clientId, payload.clientData, socket);
-    eventsBatch_.push_back(getNPCsDataEvent);
+    eventQueue_.push(std::move(getNPCsDataEvent));
 }
 
 void
@@ -391,12 +234,17 @@ EventDispatcher::handleSavePositions(
     const EventPayload &payload,
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
-    // Parse positions directly from the raw message — keeps EventPayload clean
-    auto positionsList = jsonParser_.parseSavePositionsData(payload.rawMessage.data(), payload.rawMessage.size());
-    Event saveEvent(Event::SAVE_POSITIONS, 0, positionsList, socket);
-    eventsBatch_.push_back(saveEvent);
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    try
+    {
+        // Extract positions from the already-parsed document — keeps EventPayload clean
+        auto positionsList = jsonParser_.parseSavePositionsData(messageDocument(payload));
+        Event saveEvent(Event::SAVE_POSITIONS, 0, std::move(positionsList), socket);
+        eventQueue_.push(std::move(saveEvent));
+    }
+    catch (const std::exception &ex)
+    {
+        logger_.logError("handleSavePositions parse error: " + std::string(ex.what()));
+    }
 }
 
 void
@@ -407,11 +255,13 @@ EventDispatcher::handleSaveHpMana(
     // ARCH-4: Parse HP/Mana snapshot from chunk-server and create a save event
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &arr = j["body"]["characters"];
+        const auto &body = messageBody(payload);
+        auto arrIt = body.find("characters");
+        if (arrIt == body.end() || !arrIt->is_array())
+            return;
         std::vector<CharacterDataStruct> charactersList;
-        charactersList.reserve(arr.size());
-        for (const auto &entry : arr)
+        charactersList.reserve(arrIt->size());
+        for (const auto &entry : *arrIt)
         {
             CharacterDataStruct cd;
             cd.characterId = entry.value("characterId", 0);
@@ -420,10 +270,8 @@ EventDispatcher::handleSaveHpMana(
             if (cd.characterId > 0)
                 charactersList.push_back(cd);
         }
-        Event saveEvent(Event::SAVE_HP_MANA, 0, charactersList, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        Event saveEvent(Event::SAVE_HP_MANA, 0, std::move(charactersList), socket);
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -436,11 +284,16 @@ EventDispatcher::handleSaveCharacterProgress(
     const EventPayload &payload,
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
-    auto progressList = jsonParser_.parseSaveCharacterProgressData(payload.rawMessage.data(), payload.rawMessage.size());
-    Event saveEvent(Event::SAVE_CHARACTER_PROGRESS, 0, progressList, socket);
-    eventsBatch_.push_back(saveEvent);
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    try
+    {
+        auto progressList = jsonParser_.parseSaveCharacterProgressData(messageDocument(payload));
+        Event saveEvent(Event::SAVE_CHARACTER_PROGRESS, 0, std::move(progressList), socket);
+        eventQueue_.push(std::move(saveEvent));
+    }
+    catch (const std::exception &ex)
+    {
+        logger_.logError("handleSaveCharacterProgress parse error: " + std::string(ex.what()));
+    }
 }
 
 void
@@ -451,12 +304,9 @@ EventDispatcher::handleGetPlayerQuests(
     // Expect: {"header":{"eventType":"getPlayerQuests"},"body":{"characterId":N}}
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_QUESTS, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -471,12 +321,9 @@ EventDispatcher::handleGetPlayerFlags(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_FLAGS, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -492,11 +339,8 @@ EventDispatcher::handleUpdatePlayerQuestProgress(
     // Pass the whole raw JSON to the EventHandler via nlohmann::json variant
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        Event ev(Event::UPDATE_PLAYER_QUEST_PROGRESS, 0, j, socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        Event ev(Event::UPDATE_PLAYER_QUEST_PROGRESS, 0, messageDocument(payload), socket);
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -511,11 +355,8 @@ EventDispatcher::handleUpdatePlayerFlag(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        Event ev(Event::UPDATE_PLAYER_FLAG, 0, j, socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        Event ev(Event::UPDATE_PLAYER_FLAG, 0, messageDocument(payload), socket);
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -530,12 +371,9 @@ EventDispatcher::handleGetPlayerActiveEffects(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_ACTIVE_EFFECTS, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -550,12 +388,9 @@ EventDispatcher::handleGetCharacterAttributesRefresh(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_CHARACTER_ATTRIBUTES_REFRESH, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -570,12 +405,9 @@ EventDispatcher::handleSaveInventoryChange(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_INVENTORY_CHANGE, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -590,12 +422,9 @@ EventDispatcher::handleSaveEquipmentChange(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_EQUIPMENT_CHANGE, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -610,12 +439,9 @@ EventDispatcher::handleGetPlayerInventory(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_INVENTORY, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -630,12 +456,9 @@ EventDispatcher::handleSaveExperienceDebt(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_EXPERIENCE_DEBT, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -650,12 +473,9 @@ EventDispatcher::handleSaveActiveEffect(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_ACTIVE_EFFECT, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -670,12 +490,9 @@ EventDispatcher::handleSaveDurabilityChange(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_DURABILITY_CHANGE, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -690,12 +507,9 @@ EventDispatcher::handleSaveItemKillCount(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_ITEM_KILL_COUNT, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -710,12 +524,9 @@ EventDispatcher::handleTransferInventoryItem(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::TRANSFER_INVENTORY_ITEM, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -730,12 +541,9 @@ EventDispatcher::handleNullifyItemOwner(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::NULLIFY_ITEM_OWNER, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -750,12 +558,9 @@ EventDispatcher::handleDeleteInventoryItem(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::DELETE_INVENTORY_ITEM, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -772,12 +577,9 @@ EventDispatcher::handleGetPlayerPityData(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_PITY, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -792,12 +594,9 @@ EventDispatcher::handleSavePityCounter(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_PITY_COUNTER, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -814,12 +613,9 @@ EventDispatcher::handleGetPlayerBestiaryData(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_BESTIARY, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -834,12 +630,9 @@ EventDispatcher::handleSaveBestiaryKill(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_BESTIARY_KILL, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -854,12 +647,9 @@ EventDispatcher::handleTimedChampionKilled(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event evt(Event::TIMED_CHAMPION_KILLED, 0, body, socket);
-        eventsBatch_.push_back(evt);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(evt));
     }
     catch (const std::exception &ex)
     {
@@ -876,12 +666,9 @@ EventDispatcher::handleGetPlayerReputationsData(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_REPUTATIONS, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -896,12 +683,9 @@ EventDispatcher::handleSaveReputation(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_REPUTATION, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -918,12 +702,9 @@ EventDispatcher::handleGetPlayerMasteriesData(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_MASTERIES, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -938,12 +719,9 @@ EventDispatcher::handleSaveMastery(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_MASTERY, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -957,9 +735,7 @@ EventDispatcher::handleGetMasteryDefinitionsData(
     std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
     Event ev(Event::GET_MASTERY_DEFINITIONS, 0, 0, socket);
-    eventsBatch_.push_back(ev);
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(ev));
 }
 
 void
@@ -969,12 +745,9 @@ EventDispatcher::handleSaveLearnedSkill(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_LEARNED_SKILL, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -991,12 +764,9 @@ EventDispatcher::handleSaveSkillBarSlot(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_SKILL_BAR_SLOT, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -1013,9 +783,7 @@ EventDispatcher::handleGetTitleDefinitionsData(
 {
     // No characterId needed — loads the global catalog
     Event ev(Event::GET_TITLE_DEFINITIONS, 0, 0, socket);
-    eventsBatch_.push_back(ev);
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(ev));
 }
 
 void
@@ -1025,12 +793,9 @@ EventDispatcher::handleGetPlayerTitlesData(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_TITLES, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -1045,9 +810,7 @@ EventDispatcher::handleGetEmoteDefinitionsData(
 {
     // No characterId needed — loads the global catalog
     Event ev(Event::GET_EMOTE_DEFINITIONS, 0, 0, socket);
-    eventsBatch_.push_back(ev);
-    eventQueue_.pushBatch(eventsBatch_);
-    eventsBatch_.clear();
+    eventQueue_.push(std::move(ev));
 }
 
 void
@@ -1057,12 +820,9 @@ EventDispatcher::handleGetPlayerEmotesData(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_EMOTES, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -1077,12 +837,9 @@ EventDispatcher::handleSavePlayerTitle(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_PLAYER_TITLE, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -1098,13 +855,10 @@ EventDispatcher::handleSaveSkillCooldown(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        logger_.log("[EventDispatcher] handleSaveSkillCooldown received: " + payload.rawMessage);
-        const auto &body = j["body"];
+        GS_LOG_TRACE(log_, "[EventDispatcher] handleSaveSkillCooldown received: {}", payload.rawMessage);
+        const auto &body = messageBody(payload);
         Event ev(Event::SAVE_SKILL_COOLDOWN, 0, body, socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -1119,12 +873,9 @@ EventDispatcher::handleGetPlayerSkillCooldowns(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        int characterId = j["body"].value("characterId", 0);
+        int characterId = messageBody(payload).value("characterId", 0);
         Event ev(Event::GET_PLAYER_SKILL_COOLDOWNS, characterId, static_cast<int>(characterId), socket);
-        eventsBatch_.push_back(ev);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(ev));
     }
     catch (const std::exception &ex)
     {
@@ -1142,12 +893,9 @@ EventDispatcher::handleSaveAnalyticsEvent(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
-        const auto &body = j["body"];
+        const auto &body = messageBody(payload);
         Event saveEvent(Event::SAVE_ANALYTICS_EVENT, 0, body, socket);
-        eventsBatch_.push_back(saveEvent);
-        eventQueue_.pushBatch(eventsBatch_);
-        eventsBatch_.clear();
+        eventQueue_.push(std::move(saveEvent));
     }
     catch (const std::exception &ex)
     {
@@ -1162,18 +910,16 @@ EventDispatcher::handleSavePlayTime(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
+        const auto &body = messageBody(payload);
         PlayTimeDataStruct pt;
-        pt.characterId = j["body"].value("characterId", 0);
-        pt.sessionPlayTimeSec = j["body"].value("sessionPlayTimeSec", int64_t{0});
-        pt.lastSessionPlayTimeSec = j["body"].value("lastSessionPlayTimeSec", int64_t{0});
-        pt.isDisconnect = j["body"].value("isDisconnect", false);
+        pt.characterId = body.value("characterId", 0);
+        pt.sessionPlayTimeSec = body.value("sessionPlayTimeSec", int64_t{0});
+        pt.lastSessionPlayTimeSec = body.value("lastSessionPlayTimeSec", int64_t{0});
+        pt.isDisconnect = body.value("isDisconnect", false);
         if (pt.characterId > 0)
         {
             Event saveEvent(Event::SAVE_PLAY_TIME, 0, pt, socket);
-            eventsBatch_.push_back(saveEvent);
-            eventQueue_.pushBatch(eventsBatch_);
-            eventsBatch_.clear();
+            eventQueue_.push(std::move(saveEvent));
         }
     }
     catch (const std::exception &ex)
@@ -1189,14 +935,12 @@ EventDispatcher::handleMarkCharactersOnline(
 {
     try
     {
-        auto j = nlohmann::json::parse(payload.rawMessage);
+        const auto &j = messageDocument(payload);
         if (j.contains("body") && j["body"].is_object() && j["body"].contains("characterIds") && j["body"]["characterIds"].is_array())
         {
-            nlohmann::json body = j["body"];
+            const auto &body = j["body"];
             Event event(Event::MARK_CHARACTERS_ONLINE, 0, body, socket);
-            eventsBatch_.push_back(event);
-            eventQueue_.pushBatch(eventsBatch_);
-            eventsBatch_.clear();
+            eventQueue_.push(std::move(event));
         }
     }
     catch (const std::exception &ex)
@@ -1204,3 +948,12 @@ EventDispatcher::handleMarkCharactersOnline(
         logger_.logError("handleMarkCharactersOnline parse error: " + std::string(ex.what()));
     }
 }
+
+void
+EventDispatcher::handleReloadStaticWorldData(
+    const EventPayload &payload,
+    std::shared_ptr<boost::asio::ip::tcp::socket> socket)
+{
+    Event event(Event::RELOAD_STATIC_WORLD_DATA, 0, nlohmann::json::object(), socket);
+    eventQueue_.push(std::move(event));
+}
@@ -1,5 +1,7 @@
 #include "events/EventHandler.hpp"
 #include "data/DataStructs.hpp"
+#include "utils/JsonStreamWriter.hpp"
+#include "utils/LogMacros.hpp"
 #include "utils/TerminalColors.hpp"
 #include "utils/TimestampUtils.hpp"
 
@@ -7,6 +9,22 @@
 #include <cstdlib>
 #include <spdlog/logger.h>
 
+namespace
+{
+/// Collects catalog responses while the static world bundle is built on this thread.
+struct StaticWorldBundleCapture
+{
+    int clientId = 0;
+    std::vector<StaticWorldBundle::Message> *messages = nullptr;
+    bool failed = false;
+};
+
+thread_local StaticWorldBundleCapture *currentBundleCapture = nullptr;
+
+/// A reload re-reads every static table, so requests closer together than this are refused
+constexpr auto STATIC_WORLD_RELOAD_COOLDOWN = std::chrono::seconds(30);
+} // namespace
+
 EventHandler::EventHandler(
     NetworkManager &networkManager,
     GameServices &gameServices)
@@ -31,7 +49,7 @@ EventHandler::handleJoinPlayerClientEvent(const Event &event)
         // Try to extract the data
         if (std::holds_alternative<ClientDataStruct>(data))
         {
-            ClientDataStruct passedClientData = std::get<ClientDataStruct>(data);
+            const ClientDataStruct &passedClientData = std::get<ClientDataStruct>(data);
             // Save the clientData object with the new init data
             gameServices_.getClientManager().setClientData(passedClientData);
 
@@ -53,13 +71,8 @@ EventHandler::handleJoinPlayerClientEvent(const Event &event)
                                .setHeader("eventType", "joinGameClient")
                                .setBody("", "")
                                .build();
-                // Prepare a response message
-                std::string responseData = networkManager_.generateResponseMessage("error", response);
-
                 // Send the response to the Client
-                networkManager_.sendResponse(
-                    passedClientData.socket,
-                    responseData);
+                networkManager_.sendResponseMessage(passedClientData.socket, "error", response);
                 return;
             }
 
@@ -83,15 +96,8 @@ EventHandler::handleJoinPlayerClientEvent(const Event &event)
                            .setHeader("eventType", "joinGameClient")
                            .setBody("chunkServerData", chunkServerDataJson)
                            .build();
-            // Prepare a response message
-            std::string responseData = networkManager_.generateResponseMessage("success", response);
-
             // Send the response to the Client
-            networkManager_.sendResponse(
-                passedClientData.socket,
-                responseData);
-
-            log_->info("Sending data to the Client: " + responseData);
+            networkManager_.sendResponseMessage(passedClientData.socket, "success", response);
 
             // Dispatch the event to get character data and send it to the chunk server
             Event getCharacterDataEvent(Event::GET_CHARACTER_DATA, clientID, passedClientData, chunkServerData.socket);
@@ -113,7 +119,7 @@ EventHandler::handleGetCharacterDataEvent(const Event &event)
 {
     // Here we will init data from DB of the character when client joined and send it to the chunk server
     // Retrieve the data from the event
-    const auto data = event.getData();
+    const auto &data = event.getData();
     int clientID = event.getClientID();
 
     // get socket from the event
@@ -125,7 +131,7 @@ EventHandler::handleGetCharacterDataEvent(const Event &event)
         // Try to extract the data
         if (std::holds_alternative<ClientDataStruct>(data))
         {
-            ClientDataStruct passedClientData = std::get<ClientDataStruct>(data);
+            const ClientDataStruct &passedClientData = std::get<ClientDataStruct>(data);
             // Save the clientData object with the new init data
             gameServices_.getClientManager().setClientData(passedClientData);
 
@@ -134,7 +140,9 @@ EventHandler::handleGetCharacterDataEvent(const Event &event)
                                           ", Character ID: " + std::to_string(passedClientData.characterId) +
                                           ", Hash: " + passedClientData.hash);
 
-            // Get the character data from the database
+            // Get the character data from the database (after any inventory updates still pending from a
+            // previous session, the load reads equipment durability)
+            gameServices_.getInventoryWriteBehind().flushCharacter(gameServices_.getDatabase(), passedClientData.characterId);
             CharacterDataStruct characterData = gameServices_.getCharacterManager().loadCharacterFromDatabase(
                 gameServices_.getDatabase(),
                 passedClientData.clientId,
@@ -161,13 +169,8 @@ EventHandler::handleGetCharacterDataEvent(const Event &event)
                                .setHeader("eventType", "setCharacterData")
                                .setBody("", "")
                                .build();
-                // Prepare a response message
-                std::string responseData = networkManager_.generateResponseMessage("error", response);
-
                 // Send the response to the chunk server
-                networkManager_.sendResponse(
-                    passedClientData.socket,
-                    responseData);
+                networkManager_.sendResponseMessage(passedClientData.socket, "error", response);
                 return;
             }
 
@@ -342,13 +345,8 @@ EventHandler::handleGetCharacterDataEvent(const Event &event)
                            .setBody("skillsData", skills)
                            .setBody("skillBarData", skillBarData)
                            .build();
-            // Prepare a response message
-            std::string responseData = networkManager_.generateResponseMessage("success", response);
-
             // Send the response to the chunk server
-            networkManager_.sendResponse(
-                clientSocket,
-                responseData);
+            networkManager_.sendResponseMessage(clientSocket, "success", response);
         }
         else
         {
@@ -376,7 +374,7 @@ EventHandler::handleMoveCharacterChunkEvent(const Event &event)
         // Try to extract the data
         if (std::holds_alternative<CharacterDataStruct>(data))
         {
-            CharacterDataStruct passedCharacterData = std::get<CharacterDataStruct>(data);
+            const CharacterDataStruct &passedCharacterData = std::get<CharacterDataStruct>(data);
 
             // Prepare the response message
             nlohmann::json response;
@@ -392,13 +390,8 @@ EventHandler::handleMoveCharacterChunkEvent(const Event &event)
                                .setHeader("eventType", "updateCharacterMovement")
                                .setBody("", "")
                                .build();
-                // Prepare a response message
-                std::string responseData = networkManager_.generateResponseMessage("error", response);
-
                 // Send the response to the chunk server
-                networkManager_.sendResponse(
-                    clientSocket,
-                    responseData);
+                networkManager_.sendResponseMessage(clientSocket, "error", response);
                 return;
             }
 
@@ -421,15 +414,12 @@ EventHandler::handleMoveCharacterChunkEvent(const Event &event)
                            .setBody("posZ", passedCharacterData.characterPosition.positionZ)
                            .setBody("rotZ", passedCharacterData.characterPosition.rotationZ)
                            .build();
-            // Prepare a response message
-            std::string responseData = networkManager_.generateResponseMessage("success", response);
-
-            log_->info("Sending data to Chunk Server: " + responseData);
-
-            // Send the response to the chunk server
-            networkManager_.sendResponse(
+            // A newer ack for the same character supersedes this one if it is still queued
+            networkManager_.sendResponseMessage(
                 clientSocket,
-                responseData);
+                "success",
+                response,
+                "updateCharacterMovement:" + std::to_string(passedCharacterData.characterId));
         }
         else
         {
@@ -461,13 +451,13 @@ EventHandler::handleDisconnectChunkEvent(const Event &event)
             const CharacterDataStruct &charData = std::get<CharacterDataStruct>(data);
             if (charData.characterId > 0)
             {
-                gameServices_.getCharacterManager().updateCharacterPosition(
-                    gameServices_.getDatabase(),
-                    clientID,
-                    charData.characterId,
-                    charData.characterPosition);
-                log_->info(
-                    "Saved position on disconnect for characterId: " + std::to_string(charData.characterId));
+                // Writes the final position together with anything else still pending for the character
+                auto &characterManager = gameServices_.getCharacterManager();
+                characterManager.markPositionDirty(charData.characterId, charData.characterPosition);
+                if (characterManager.flushCharacter(gameServices_.getDatabase(), charData.characterId))
+                    GS_LOG_INFO(log_, "Saved position on disconnect for characterId: {}", charData.characterId);
+                gameServices_.getInventoryWriteBehind().flushCharacter(gameServices_.getDatabase(), charData.characterId);
+                gameServices_.getCharacterAttributeService().forgetCharacter(charData.characterId);
             }
         }
 
@@ -494,10 +484,9 @@ EventHandler::handleDisconnectChunkEvent(const Event &event)
                        .setHeader("eventType", "disconnectClient")
                        .setBody("", "")
                        .build();
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
 
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
     }
     catch (const std::bad_variant_access &ex)
     {
@@ -535,10 +524,8 @@ EventHandler::handleJoinChunkServerEvent(const Event &event)
                            .setHeader("eventType", "setChunkData")
                            .setBody("chunkServerData", chunkServerDataJson)
                            .build();
-            // Prepare a response message
-            std::string responseData = networkManager_.generateResponseMessage("error", response);
             // Send the response to the client
-            networkManager_.sendResponse(clientSocket, responseData);
+            networkManager_.sendResponseMessage(clientSocket, "error", response);
             return;
         }
 
@@ -566,137 +553,213 @@ EventHandler::handleJoinChunkServerEvent(const Event &event)
             chunkServerDataJson["sizeY"] = chunkData.sizeY;
             chunkServerDataJson["sizeZ"] = chunkData.sizeZ;
 
-            // load spawn zones
-            Event spawnZonesEvent(Event::GET_SPAWN_ZONES, clientID, SpawnZoneStruct(), clientSocket);
-            dispatchEvent(spawnZonesEvent);
+            // Static catalogs are built once and replayed from the cached bundle;
+            // only the first join after startup or a reload hits the database.
+            auto bundle = gameServices_.getStaticWorldBundle().getOrBuild(
+                [this, clientID, &clientSocket](std::vector<StaticWorldBundle::Message> &messages)
+                { return buildStaticWorldBundle(clientID, clientSocket, messages); });
 
-            // load mobs
-            Event mobDataEvent(Event::GET_MOBS_LIST, clientID, MobDataStruct(), clientSocket);
-            dispatchEvent(mobDataEvent);
+            const WireFormat format = networkManager_.getWireFormat(clientSocket);
+            if (format == WireFormat::Json)
+            {
+                for (const auto &message : bundle->messages)
+                {
+                    networkManager_.sendResponse(clientSocket, StaticWorldBundle::render(message, clientID));
+                }
+            }
+            else
+            {
+                // Bodies are encoded once per bundle version; only headers are encoded per join
+                auto prepared = StaticWorldBundle::prepared(*bundle, format);
+                for (std::size_t i = 0; i < bundle->messages.size(); ++i)
+                {
+                    networkManager_.sendFrame(clientSocket,
+                        StaticWorldBundle::renderFrame(bundle->messages[i], (*prepared)[i], format, clientID));
+                }
+            }
+            log_->info("[BUNDLE] Sent world bundle v{} ({} messages, {} bytes) to chunk server {}",
+                bundle->version, bundle->messages.size(), bundle->totalBytes, clientID);
+        }
 
-            // load mobs attributes
-            Event mobAttributesEvent(Event::GET_MOBS_ATTRIBUTES, clientID, MobAttributeStruct(), clientSocket);
-            dispatchEvent(mobAttributesEvent);
+        // Add the message to the response
+        response = builder
+                       .setHeader("message", "Joining chunk server success!")
+                       .setHeader("hash", "")
+                       .setHeader("clientId", clientID)
+                       .setHeader("eventType", "setChunkData")
+                       .setBody("id", chunkServerDataJson["id"])
+                       .setBody("ip", chunkServerDataJson["ip"])
+                       .setBody("port", chunkServerDataJson["port"])
+                       .setBody("posX", chunkServerDataJson["posX"])
+                       .setBody("posY", chunkServerDataJson["posY"])
+                       .setBody("posZ", chunkServerDataJson["posZ"])
+                       .setBody("sizeX", chunkServerDataJson["sizeX"])
+                       .setBody("sizeY", chunkServerDataJson["sizeY"])
+                       .setBody("sizeZ", chunkServerDataJson["sizeZ"])
+                       .build();
+        // Send the response to the client
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
+    }
+    catch (const std::bad_variant_access &ex)
+    {
+        gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
+    }
+}
 
-            // load NPCs
-            Event npcDataEvent(Event::GET_NPCS_LIST, clientID, NPCDataStruct(), clientSocket);
-            dispatchEvent(npcDataEvent);
+bool
+EventHandler::buildStaticWorldBundle(int clientID,
+    const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket,
+    std::vector<StaticWorldBundle::Message> &messages)
+{
+    StaticWorldBundleCapture capture;
+    capture.clientId = clientID;
+    capture.messages = &messages;
 
-            // load NPCs attributes
-            Event npcAttributesEvent(Event::GET_NPCS_ATTRIBUTES, clientID, NPCAttributeStruct(), clientSocket);
-            dispatchEvent(npcAttributesEvent);
+    // Reset the capture even if one of the handlers throws
+    struct CaptureScope
+    {
+        explicit CaptureScope(StaticWorldBundleCapture *c) { currentBundleCapture = c; }
+        ~CaptureScope() { currentBundleCapture = nullptr; }
+    } scope(&capture);
 
-            // load items
-            Event itemsEvent(Event::GET_ITEMS_LIST, clientID, ItemDataStruct(), clientSocket);
-            dispatchEvent(itemsEvent);
+    // load spawn zones
+    Event spawnZonesEvent(Event::GET_SPAWN_ZONES, clientID, SpawnZoneStruct(), clientSocket);
+    dispatchEvent(spawnZonesEvent);
 
-            // load mob loot info
-            Event mobLootEvent(Event::GET_MOB_LOOT_INFO, clientID, MobLootInfoStruct(), clientSocket);
-            dispatchEvent(mobLootEvent);
+    // load mobs
+    Event mobDataEvent(Event::GET_MOBS_LIST, clientID, MobDataStruct(), clientSocket);
+    dispatchEvent(mobDataEvent);
 
-            // load experience level table
-            Event expLevelTableEvent(Event::GET_EXP_LEVEL_TABLE, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(expLevelTableEvent);
+    // load mobs attributes
+    Event mobAttributesEvent(Event::GET_MOBS_ATTRIBUTES, clientID, MobAttributeStruct(), clientSocket);
+    dispatchEvent(mobAttributesEvent);
 
-            // load dialogues and NPC dialogue mappings
-            Event dialoguesEvent(Event::GET_DIALOGUES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(dialoguesEvent);
+    // load NPCs
+    Event npcDataEvent(Event::GET_NPCS_LIST, clientID, NPCDataStruct(), clientSocket);
+    dispatchEvent(npcDataEvent);
 
-            // load quests
-            Event questsEvent(Event::GET_QUESTS, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(questsEvent);
+    // load NPCs attributes
+    Event npcAttributesEvent(Event::GET_NPCS_ATTRIBUTES, clientID, NPCAttributeStruct(), clientSocket);
+    dispatchEvent(npcAttributesEvent);
 
-            // load game config
-            gameServices_.getGameConfigService().loadConfig();
-            Event gameConfigEvent(Event::GET_GAME_CONFIG, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(gameConfigEvent);
+    // load items
+    Event itemsEvent(Event::GET_ITEMS_LIST, clientID, ItemDataStruct(), clientSocket);
+    dispatchEvent(itemsEvent);
 
-            // load vendor NPC inventory
-            Event vendorDataEvent(Event::GET_VENDOR_DATA, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(vendorDataEvent);
+    // load mob loot info
+    Event mobLootEvent(Event::GET_MOB_LOOT_INFO, clientID, MobLootInfoStruct(), clientSocket);
+    dispatchEvent(mobLootEvent);
 
-            // load trainer NPC skill lists
-            Event trainerDataEvent(Event::GET_TRAINER_DATA, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(trainerDataEvent);
+    // load experience level table
+    Event expLevelTableEvent(Event::GET_EXP_LEVEL_TABLE, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(expLevelTableEvent);
 
-            // load respawn zones
-            Event respawnZonesEvent(Event::GET_RESPAWN_ZONES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(respawnZonesEvent);
+    // load dialogues and NPC dialogue mappings
+    Event dialoguesEvent(Event::GET_DIALOGUES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(dialoguesEvent);
 
-            // load class spawn zones
-            Event classSpawnZonesEvent(Event::GET_CLASS_SPAWN_ZONES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(classSpawnZonesEvent);
+    // load quests
+    Event questsEvent(Event::GET_QUESTS, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(questsEvent);
 
-            // load game zones (AABB bounds + exploration XP)
-            Event gameZonesEvent(Event::GET_GAME_ZONES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(gameZonesEvent);
+    // load game config
+    gameServices_.getGameConfigService().loadConfig();
+    Event gameConfigEvent(Event::GET_GAME_CONFIG, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(gameConfigEvent);
 
-            // load status effect templates (data-driven buff/debuff config)
-            Event statusEffectTemplatesEvent(Event::GET_STATUS_EFFECT_TEMPLATES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(statusEffectTemplatesEvent);
+    // load vendor NPC inventory
+    Event vendorDataEvent(Event::GET_VENDOR_DATA, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(vendorDataEvent);
 
-            // load timed champion templates (Stage 3 — mob ecosystem)
-            Event timedChampionTemplatesEvent(Event::GET_TIMED_CHAMPION_TEMPLATES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(timedChampionTemplatesEvent);
+    // load trainer NPC skill lists
+    Event trainerDataEvent(Event::GET_TRAINER_DATA, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(trainerDataEvent);
 
-            // load zone event templates (Stage 4 — world events)
-            Event zoneEventTemplatesEvent(Event::GET_ZONE_EVENT_TEMPLATES, clientID, ClientDataStruct(), clientSocket);
-            dispatchEvent(zoneEventTemplatesEvent);
+    // load respawn zones
+    Event respawnZonesEvent(Event::GET_RESPAWN_ZONES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(respawnZonesEvent);
 
-            // load mastery definitions (global catalog — defines which attribute each mastery type buffs)
-            Event masteryDefsEvent(Event::GET_MASTERY_DEFINITIONS, clientID, 0, clientSocket);
-            dispatchEvent(masteryDefsEvent);
+    // load class spawn zones
+    Event classSpawnZonesEvent(Event::GET_CLASS_SPAWN_ZONES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(classSpawnZonesEvent);
 
-            // load title definitions (global catalog — same lifetime as zone templates)
-            Event titleDefsEvent(Event::GET_TITLE_DEFINITIONS, clientID, 0, clientSocket);
-            dispatchEvent(titleDefsEvent);
+    // load game zones (AABB bounds + exploration XP)
+    Event gameZonesEvent(Event::GET_GAME_ZONES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(gameZonesEvent);
 
-            // load emote definitions (global catalog)
-            Event emoteDefsEvent(Event::GET_EMOTE_DEFINITIONS, clientID, 0, clientSocket);
-            dispatchEvent(emoteDefsEvent);
+    // load status effect templates (data-driven buff/debuff config)
+    Event statusEffectTemplatesEvent(Event::GET_STATUS_EFFECT_TEMPLATES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(statusEffectTemplatesEvent);
 
-            // load NPC ambient speech configs + lines
-            Event ambientSpeechEvent(Event::GET_NPC_AMBIENT_SPEECH, clientID, 0, clientSocket);
-            dispatchEvent(ambientSpeechEvent);
+    // load timed champion templates (Stage 3 — mob ecosystem)
+    Event timedChampionTemplatesEvent(Event::GET_TIMED_CHAMPION_TEMPLATES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(timedChampionTemplatesEvent);
 
-            // load world interactive objects (migration 043)
-            Event worldObjectsEvent(Event::GET_WORLD_OBJECTS, clientID, 0, clientSocket);
-            dispatchEvent(worldObjectsEvent);
-        }
+    // load zone event templates (Stage 4 — world events)
+    Event zoneEventTemplatesEvent(Event::GET_ZONE_EVENT_TEMPLATES, clientID, ClientDataStruct(), clientSocket);
+    dispatchEvent(zoneEventTemplatesEvent);
 
-        // Add the message to the response
-        response = builder
-                       .setHeader("message", "Joining chunk server success!")
-                       .setHeader("hash", "")
-                       .setHeader("clientId", clientID)
-                       .setHeader("eventType", "setChunkData")
-                       .setBody("id", chunkServerDataJson["id"])
-                       .setBody("ip", chunkServerDataJson["ip"])
-                       .setBody("port", chunkServerDataJson["port"])
-                       .setBody("posX", chunkServerDataJson["posX"])
-                       .setBody("posY", chunkServerDataJson["posY"])
-                       .setBody("posZ", chunkServerDataJson["posZ"])
-                       .setBody("sizeX", chunkServerDataJson["sizeX"])
-                       .setBody("sizeY", chunkServerDataJson["sizeY"])
-                       .setBody("sizeZ", chunkServerDataJson["sizeZ"])
-                       .build();
-        // Prepare a response message
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
+    // load mastery definitions (global catalog — defines which attribute each mastery type buffs)
+    Event masteryDefsEvent(Event::GET_MASTERY_DEFINITIONS, clientID, 0, clientSocket);
+    dispatchEvent(masteryDefsEvent);
 
-        // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+    // load title definitions (global catalog — same lifetime as zone templates)
+    Event titleDefsEvent(Event::GET_TITLE_DEFINITIONS, clientID, 0, clientSocket);
+    dispatchEvent(titleDefsEvent);
+
+    // load emote definitions (global catalog)
+    Event emoteDefsEvent(Event::GET_EMOTE_DEFINITIONS, clientID, 0, clientSocket);
+    dispatchEvent(emoteDefsEvent);
+
+    // load NPC ambient speech configs + lines
+    Event ambientSpeechEvent(Event::GET_NPC_AMBIENT_SPEECH, clientID, 0, clientSocket);
+    dispatchEvent(ambientSpeechEvent);
+
+    // load world interactive objects (migration 043)
+    Event worldObjectsEvent(Event::GET_WORLD_OBJECTS, clientID, 0, clientSocket);
+    dispatchEvent(worldObjectsEvent);
+
+    return !capture.failed;
+}
+
+void
+EventHandler::sendCatalogResponse(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket,
+    const std::string &status,
+    const nlohmann::json &response)
+{
+    if (currentBundleCapture)
+    {
+        currentBundleCapture->messages->push_back(StaticWorldBundle::makeMessage(
+            networkManager_.generateResponseMessage(status, response), currentBundleCapture->clientId));
+        return;
     }
-    catch (const std::bad_variant_access &ex)
+    networkManager_.sendResponseMessage(clientSocket, status, response);
+}
+
+void
+EventHandler::sendCatalogResponse(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket,
+    std::string responseData)
+{
+    if (currentBundleCapture)
     {
-        gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
+        currentBundleCapture->messages->push_back(
+            StaticWorldBundle::makeMessage(responseData, currentBundleCapture->clientId));
+        return;
     }
+    networkManager_.sendResponse(clientSocket, std::move(responseData));
+}
+
+void
+EventHandler::markCatalogResponseFailed()
+{
+    if (currentBundleCapture)
+        currentBundleCapture->failed = true;
 }
 
 void
 EventHandler::handleDisconnectChunkServerEvent(const Event &event)
 {
     // Here we will disconnect the chunk server
-    const auto data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
@@ -735,10 +798,9 @@ EventHandler::handleDisconnectChunkServerEvent(const Event &event)
                        .setHeader("eventType", "disconnectChunkServer")
                        .setBody("", "")
                        .build();
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
 
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
     }
     catch (const std::bad_variant_access &ex)
     {
@@ -750,8 +812,6 @@ EventHandler::handleDisconnectChunkServerEvent(const Event &event)
 void
 EventHandler::handleGetMobsAttributesEvent(const Event &event)
 {
-    // Retrieve the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
@@ -798,14 +858,12 @@ EventHandler::handleGetMobsAttributesEvent(const Event &event)
                        .setHeader("eventType", "setMobsAttributes")
                        .setBody("mobsAttributesList", mobsAttributesListJson)
                        .build();
-        // Prepare a response message
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
     }
     catch (const std::bad_variant_access &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
     }
 }
@@ -814,173 +872,159 @@ EventHandler::handleGetMobsAttributesEvent(const Event &event)
 void
 EventHandler::handleGetMobsListEvent(const Event &event)
 {
-    // Retrieve the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
 
     try
     {
-        // load the mobs list from the database
-        gameServices_.getMobManager().loadMobs();
-
-        // Get the mobs list from the database as map
+        // Serve from the snapshot loaded at startup (MobManager::loadMobs) — no reload per chunk join
         auto mobsListMap = gameServices_.getMobManager().getMobs();
 
-        nlohmann::json mobsListJson;
+        // Streamed straight into the response buffer: no per-mob DOM, no envelope copies
+        ResponseStream mobsStream;
+        JsonStreamWriter &rows = mobsStream.body();
+        rows.key("mobsList").beginArray();
         for (const auto &mobItem : mobsListMap)
         {
             const MobDataStruct &mobData = mobItem.second;
 
-            // Create a JSON object for the current mob
-            nlohmann::json mobJson;
-            mobJson["id"] = mobData.id;
-            mobJson["UID"] = mobData.uid;
-            mobJson["zoneId"] = mobData.zoneId;
-            mobJson["name"] = mobData.name;
-            mobJson["slug"] = mobData.slug;
-            mobJson["race"] = mobData.raceName;
-            mobJson["level"] = mobData.level;
-            mobJson["baseExperience"] = mobData.baseExperience;
-            mobJson["radius"] = mobData.radius;
-            mobJson["currentHealth"] = mobData.currentHealth;
-            mobJson["currentMana"] = mobData.currentMana;
-            mobJson["maxMana"] = mobData.maxMana;
-            mobJson["maxHealth"] = mobData.maxHealth;
-            mobJson["isAggressive"] = mobData.isAggressive;
-            mobJson["isDead"] = mobData.isDead;
-            mobJson["posX"] = mobData.position.positionX;
-            mobJson["posY"] = mobData.position.positionY;
-            mobJson["posZ"] = mobData.position.positionZ;
-            mobJson["rotZ"] = mobData.position.rotationZ;
+            rows.beginObject();
+            rows.field("id", mobData.id);
+            rows.field("UID", mobData.uid);
+            rows.field("zoneId", mobData.zoneId);
+            rows.field("name", mobData.name);
+            rows.field("slug", mobData.slug);
+            rows.field("race", mobData.raceName);
+            rows.field("level", mobData.level);
+            rows.field("baseExperience", mobData.baseExperience);
+            rows.field("radius", mobData.radius);
+            rows.field("currentHealth", mobData.currentHealth);
+            rows.field("currentMana", mobData.currentMana);
+            rows.field("maxMana", mobData.maxMana);
+            rows.field("maxHealth", mobData.maxHealth);
+            rows.field("isAggressive", mobData.isAggressive);
+            rows.field("isDead", mobData.isDead);
+            rows.field("posX", mobData.position.positionX);
+            rows.field("posY", mobData.position.positionY);
+            rows.field("posZ", mobData.position.positionZ);
+            rows.field("rotZ", mobData.position.rotationZ);
 
             // Per-mob AI config (migration 011)
-            mobJson["aggroRange"] = mobData.aggroRange;
-            mobJson["attackRange"] = mobData.attackRange;
-            mobJson["attackCooldown"] = mobData.attackCooldown;
-            mobJson["chaseMultiplier"] = mobData.chaseMultiplier;
-            mobJson["patrolSpeed"] = mobData.patrolSpeed;
-            mobJson["patrolRadius"] = mobData.patrolRadius;
+            rows.field("aggroRange", mobData.aggroRange);
+            rows.field("attackRange", mobData.attackRange);
+            rows.field("attackCooldown", mobData.attackCooldown);
+            rows.field("chaseMultiplier", mobData.chaseMultiplier);
+            rows.field("patrolSpeed", mobData.patrolSpeed);
+            rows.field("patrolRadius", mobData.patrolRadius);
 
             // Social behaviour (migration 012)
-            mobJson["isSocial"] = mobData.isSocial;
-            mobJson["chaseDuration"] = mobData.chaseDuration;
+            rows.field("isSocial", mobData.isSocial);
+            rows.field("chaseDuration", mobData.chaseDuration);
 
             // Rank / difficulty tier (migrations 006/023)
-            mobJson["rankId"] = mobData.rankId;
-            mobJson["rankCode"] = mobData.rankCode;
-            mobJson["rankMult"] = mobData.rankMult;
+            rows.field("rankId", mobData.rankId);
+            rows.field("rankCode", mobData.rankCode);
+            rows.field("rankMult", mobData.rankMult);
 
             // AI depth: flee behavior + archetype (migration 016)
-            mobJson["fleeHpThreshold"] = mobData.fleeHpThreshold;
-            mobJson["aiArchetype"] = mobData.aiArchetype;
+            rows.field("fleeHpThreshold", mobData.fleeHpThreshold);
+            rows.field("aiArchetype", mobData.aiArchetype);
 
             // Survival / Rare mob groundwork (Stage 3, migration 038)
-            mobJson["canEvolve"] = mobData.canEvolve;
-            mobJson["isRare"] = mobData.isRare;
-            mobJson["rareSpawnChance"] = mobData.rareSpawnChance;
-            mobJson["rareSpawnCondition"] = mobData.rareSpawnCondition;
+            rows.field("canEvolve", mobData.canEvolve);
+            rows.field("isRare", mobData.isRare);
+            rows.field("rareSpawnChance", mobData.rareSpawnChance);
+            rows.field("rareSpawnCondition", mobData.rareSpawnCondition);
 
             // Social systems (Stage 4, migration 039)
-            mobJson["factionSlug"] = mobData.factionSlug;
-            mobJson["repDeltaPerKill"] = mobData.repDeltaPerKill;
+            rows.field("factionSlug", mobData.factionSlug);
+            rows.field("repDeltaPerKill", mobData.repDeltaPerKill);
 
             // Bestiary metadata (migration 040)
-            mobJson["biomeSlug"] = mobData.biomeSlug;
-            mobJson["mobTypeSlug"] = mobData.mobTypeSlug;
-            mobJson["hpMin"] = mobData.hpMin;
-            mobJson["hpMax"] = mobData.hpMax;
+            rows.field("biomeSlug", mobData.biomeSlug);
+            rows.field("mobTypeSlug", mobData.mobTypeSlug);
+            rows.field("hpMin", mobData.hpMin);
+            rows.field("hpMax", mobData.hpMax);
 
-            // Add the current item to the mobs list json
-            mobsListJson.push_back(mobJson);
+            rows.endObject();
         }
+        rows.endArray();
 
         // If the mobs list is empty, log a message
-        if (mobsListJson.empty())
+        if (mobsListMap.empty())
         {
             log_->info("Mobs list is empty!");
         }
 
-        // Prepare the response message
-        nlohmann::json response;
-        ResponseBuilder builder;
-
-        // Add the message to the response
-        response = builder
-                       .setHeader("message", "Getting mobs list success!")
-                       .setHeader("hash", "")
-                       .setHeader("clientId", clientID)
-                       .setHeader("eventType", "setMobsList")
-                       .setBody("mobsList", mobsListJson)
-                       .build();
-        // Prepare a response message
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
+        nlohmann::json header = ResponseBuilder()
+                                    .setHeader("message", "Getting mobs list success!")
+                                    .setHeader("hash", "")
+                                    .setHeader("clientId", clientID)
+                                    .setHeader("eventType", "setMobsList")
+                                    .build()["header"];
 
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, mobsStream.finish("success", header));
 
         // After sending mobs list, send mobs skills
-        nlohmann::json mobsSkillsJson;
+        ResponseStream skillsStream;
+        JsonStreamWriter &skillRows = skillsStream.body();
+        std::size_t mobsWithSkills = 0;
+        skillRows.key("mobsSkills").beginArray();
         for (const auto &mobItem : mobsListMap)
         {
             const MobDataStruct &mobData = mobItem.second;
-
-            // Get skills for this mob from database
-            auto mobSkills = gameServices_.getCharacterManager().getMobSkillsFromDatabase(
-                gameServices_.getDatabase(), mobData.id);
+            const auto &mobSkills = mobData.skills;
 
             if (!mobSkills.empty())
             {
-                nlohmann::json mobSkillsEntry;
-                mobSkillsEntry["mobId"] = mobData.id;
+                ++mobsWithSkills;
+                skillRows.beginObject();
+                skillRows.field("mobId", mobData.id);
 
-                nlohmann::json skillsArray;
+                skillRows.key("skills").beginArray();
                 for (const auto &skill : mobSkills)
                 {
-                    nlohmann::json skillJson;
-                    skillJson["skillName"] = skill.skillName;
-                    skillJson["skillSlug"] = skill.skillSlug;
-                    skillJson["scaleStat"] = skill.scaleStat;
-                    skillJson["school"] = skill.school;
-                    skillJson["skillEffectType"] = skill.skillEffectType;
-                    skillJson["skillLevel"] = skill.skillLevel;
-                    skillJson["coeff"] = skill.coeff;
-                    skillJson["flatAdd"] = skill.flatAdd;
-                    skillJson["cooldownMs"] = skill.cooldownMs;
-                    skillJson["gcdMs"] = skill.gcdMs;
-                    skillJson["castMs"] = skill.castMs;
-                    skillJson["costMp"] = skill.costMp;
-                    skillJson["maxRange"] = skill.maxRange;
-                    skillJson["areaRadius"] = skill.areaRadius;
-                    skillJson["swingMs"] = skill.swingMs;
-                    skillJson["animationName"] = skill.animationName;
-                    skillsArray.push_back(skillJson);
+                    skillRows.beginObject();
+                    skillRows.field("skillName", skill.skillName);
+                    skillRows.field("skillSlug", skill.skillSlug);
+                    skillRows.field("scaleStat", skill.scaleStat);
+                    skillRows.field("school", skill.school);
+                    skillRows.field("skillEffectType", skill.skillEffectType);
+                    skillRows.field("skillLevel", skill.skillLevel);
+                    skillRows.field("coeff", skill.coeff);
+                    skillRows.field("flatAdd", skill.flatAdd);
+                    skillRows.field("cooldownMs", skill.cooldownMs);
+                    skillRows.field("gcdMs", skill.gcdMs);
+                    skillRows.field("castMs", skill.castMs);
+                    skillRows.field("costMp", skill.costMp);
+                    skillRows.field("maxRange", skill.maxRange);
+                    skillRows.field("areaRadius", skill.areaRadius);
+                    skillRows.field("swingMs", skill.swingMs);
+                    skillRows.field("animationName", skill.animationName);
+                    skillRows.endObject();
                 }
-
-                mobSkillsEntry["skills"] = skillsArray;
-                mobsSkillsJson.push_back(mobSkillsEntry);
+                skillRows.endArray();
+                skillRows.endObject();
             }
         }
+        skillRows.endArray();
 
         // Send mobs skills if any exist
-        if (!mobsSkillsJson.empty())
+        if (mobsWithSkills > 0)
         {
-            nlohmann::json skillsResponse;
-            ResponseBuilder skillsBuilder;
-
-            skillsResponse = skillsBuilder
-                                 .setHeader("message", "Getting mobs skills success!")
-                                 .setHeader("hash", "")
-                                 .setHeader("clientId", clientID)
-                                 .setHeader("eventType", "setMobsSkills")
-                                 .setBody("mobsSkills", mobsSkillsJson)
-                                 .build();
+            nlohmann::json skillsHeader = ResponseBuilder()
+                                              .setHeader("message", "Getting mobs skills success!")
+                                              .setHeader("hash", "")
+                                              .setHeader("clientId", clientID)
+                                              .setHeader("eventType", "setMobsSkills")
+                                              .build()["header"];
 
-            std::string skillsResponseData = networkManager_.generateResponseMessage("success", skillsResponse);
-            networkManager_.sendResponse(clientSocket, skillsResponseData);
+            sendCatalogResponse(clientSocket,
+                skillsStream.finish("success", skillsHeader));
 
-            gameServices_.getLogger().log("Sent skills for " + std::to_string(mobsSkillsJson.size()) + " mobs", GREEN);
+            gameServices_.getLogger().log("Sent skills for " + std::to_string(mobsWithSkills) + " mobs", GREEN);
         }
         else
         {
@@ -1026,8 +1070,7 @@ EventHandler::handleGetMobsListEvent(const Event &event)
                                                 .setHeader("eventType", "setMobWeaknessesResistances")
                                                 .setBody("data", wrJson)
                                                 .build();
-                networkManager_.sendResponse(clientSocket,
-                    networkManager_.generateResponseMessage("success", wrResponse));
+                sendCatalogResponse(clientSocket, "success", wrResponse);
                 log_->info("[EH] Sent weaknesses/resistances for " +
                            std::to_string(wrJson.size()) + " mobs");
             }
@@ -1035,6 +1078,7 @@ EventHandler::handleGetMobsListEvent(const Event &event)
     }
     catch (const std::bad_variant_access &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
     }
 }
@@ -1056,7 +1100,7 @@ EventHandler::handleGetMobDataEvent(const Event &event)
         // Try to extract the data
         if (std::holds_alternative<MobDataStruct>(data))
         {
-            MobDataStruct passedMobData = std::get<MobDataStruct>(data);
+            const MobDataStruct &passedMobData = std::get<MobDataStruct>(data);
             // Get the mob data from the database as map
             auto mobDataMap = gameServices_.getMobManager().getMobs();
 
@@ -1117,11 +1161,8 @@ EventHandler::handleGetMobDataEvent(const Event &event)
                                .setHeader("eventType", "getMobData")
                                .setBody("mobData", mobJson)
                                .build();
-                // Prepare a response message
-                std::string responseData = networkManager_.generateResponseMessage("success", response);
-
                 // Send the response to the client
-                networkManager_.sendResponse(clientSocket, responseData);
+                networkManager_.sendResponseMessage(clientSocket, "success", response);
             }
             else
             {
@@ -1137,11 +1178,8 @@ EventHandler::handleGetMobDataEvent(const Event &event)
                                .setHeader("eventType", "getMobData")
                                .setBody("", "")
                                .build();
-                // Prepare a response message
-                std::string responseData = networkManager_.generateResponseMessage("error", response);
-
                 // Send the response to the client
-                networkManager_.sendResponse(clientSocket, responseData);
+                networkManager_.sendResponseMessage(clientSocket, "error", response);
             }
         }
         else
@@ -1158,10 +1196,8 @@ EventHandler::handleGetMobDataEvent(const Event &event)
                            .setHeader("eventType", "getMobData")
                            .setBody("", "")
                            .build();
-            // Prepare a response message
-            std::string responseData = networkManager_.generateResponseMessage("error", response);
             // Send the response to the client
-            networkManager_.sendResponse(clientSocket, responseData);
+            networkManager_.sendResponseMessage(clientSocket, "error", response);
         }
     }
     catch (const std::bad_variant_access &ex)
@@ -1174,8 +1210,6 @@ EventHandler::handleGetMobDataEvent(const Event &event)
 void
 EventHandler::handleGetSpawnZonesEvent(const Event &event)
 {
-    // get the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
 
     // get socket from the event
@@ -1255,10 +1289,8 @@ EventHandler::handleGetSpawnZonesEvent(const Event &event)
                            .setHeader("eventType", "setSpawnZonesList")
                            .setBody("", "")
                            .build();
-            // Prepare a response message
-            std::string responseData = networkManager_.generateResponseMessage("error", response);
             // Send the response to the client
-            networkManager_.sendResponse(clientSocket, responseData);
+            sendCatalogResponse(clientSocket, "error", response);
             return;
         }
 
@@ -1270,14 +1302,12 @@ EventHandler::handleGetSpawnZonesEvent(const Event &event)
                        .setHeader("eventType", "setSpawnZonesList")
                        .setBody("spawnZonesData", spawnZonesJson)
                        .build();
-        // Prepare a response message
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
     }
     catch (const std::bad_variant_access &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
     }
 }
@@ -1534,6 +1564,10 @@ EventHandler::dispatchEvent(const Event &event)
         handleMarkCharactersOnlineEvent(event);
         break;
 
+    case Event::RELOAD_STATIC_WORLD_DATA:
+        handleReloadStaticWorldDataEvent(event);
+        break;
+
     // chunk server events
     case Event::JOIN_CHUNK_SERVER:
         handleJoinChunkServerEvent(event);
@@ -1548,8 +1582,6 @@ EventHandler::dispatchEvent(const Event &event)
 void
 EventHandler::handleGetItemsListEvent(const Event &event)
 {
-    // Retrieve the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
@@ -1559,98 +1591,97 @@ EventHandler::handleGetItemsListEvent(const Event &event)
         // Get the items list from the database as map
         auto itemsList = gameServices_.getItemManager().getItems();
 
-        nlohmann::json itemsListJson = nlohmann::json::array();
+        // Streamed straight into the response buffer: no per-item DOM, no envelope copies
+        ResponseStream itemsStream;
+        JsonStreamWriter &rows = itemsStream.body();
+        rows.key("itemsList").beginArray();
 
         for (const auto &itemItem : itemsList)
         {
             const ItemDataStruct &itemData = itemItem.second;
 
-            nlohmann::json itemJson;
-            itemJson["id"] = itemData.id;
-            itemJson["slug"] = itemData.slug;
-            itemJson["isQuestItem"] = itemData.isQuestItem;
-            itemJson["itemType"] = itemData.itemType;
-            itemJson["itemTypeName"] = itemData.itemTypeName;
-            itemJson["itemTypeSlug"] = itemData.itemTypeSlug;
-            itemJson["isContainer"] = itemData.isContainer;
-            itemJson["isDurable"] = itemData.isDurable;
-            itemJson["isTradable"] = itemData.isTradable;
-            itemJson["isEquippable"] = itemData.isEquippable;
-            itemJson["isHarvest"] = itemData.isHarvest;
-            itemJson["isUsable"] = itemData.isUsable;
-            itemJson["weight"] = itemData.weight;
-            itemJson["rarityId"] = itemData.rarityId;
-            itemJson["rarityName"] = itemData.rarityName;
-            itemJson["raritySlug"] = itemData.raritySlug;
-            itemJson["stackMax"] = itemData.stackMax;
-            itemJson["durabilityMax"] = itemData.durabilityMax;
-            itemJson["vendorPriceBuy"] = itemData.vendorPriceBuy;
-            itemJson["vendorPriceSell"] = itemData.vendorPriceSell;
-            itemJson["equipSlot"] = itemData.equipSlot;
-            itemJson["equipSlotName"] = itemData.equipSlotName;
-            itemJson["equipSlotSlug"] = itemData.equipSlotSlug;
-            itemJson["levelRequirement"] = itemData.levelRequirement;
-            itemJson["isTwoHanded"] = itemData.isTwoHanded;
-
-            nlohmann::json allowedClassIdsArray = nlohmann::json::array();
-            for (int classId : itemData.allowedClassIds)
-                allowedClassIdsArray.push_back(classId);
-            itemJson["allowedClassIds"] = allowedClassIdsArray;
-
-            itemJson["setId"] = itemData.setId;
-            itemJson["setSlug"] = itemData.setSlug;
+            rows.beginObject();
+            rows.field("id", itemData.id);
+            rows.field("slug", itemData.slug);
+            rows.field("isQuestItem", itemData.isQuestItem);
+            rows.field("itemType", itemData.itemType);
+            rows.field("itemTypeName", itemData.itemTypeName);
+            rows.field("itemTypeSlug", itemData.itemTypeSlug);
+            rows.field("isContainer", itemData.isContainer);
+            rows.field("isDurable", itemData.isDurable);
+            rows.field("isTradable", itemData.isTradable);
+            rows.field("isEquippable", itemData.isEquippable);
+            rows.field("isHarvest", itemData.isHarvest);
+            rows.field("isUsable", itemData.isUsable);
+            rows.field("weight", itemData.weight);
+            rows.field("rarityId", itemData.rarityId);
+            rows.field("rarityName", itemData.rarityName);
+            rows.field("raritySlug", itemData.raritySlug);
+            rows.field("stackMax", itemData.stackMax);
+            rows.field("durabilityMax", itemData.durabilityMax);
+            rows.field("vendorPriceBuy", itemData.vendorPriceBuy);
+            rows.field("vendorPriceSell", itemData.vendorPriceSell);
+            rows.field("equipSlot", itemData.equipSlot);
+            rows.field("equipSlotName", itemData.equipSlotName);
+            rows.field("equipSlotSlug", itemData.equipSlotSlug);
+            rows.field("levelRequirement", itemData.levelRequirement);
+            rows.field("isTwoHanded", itemData.isTwoHanded);
+
+            rows.arrayField("allowedClassIds", itemData.allowedClassIds);
+
+            rows.field("setId", itemData.setId);
+            rows.field("setSlug", itemData.setSlug);
 
             // Add attributes
-            nlohmann::json attributesArray = nlohmann::json::array();
+            rows.key("attributes").beginArray();
             for (const auto &attribute : itemData.attributes)
             {
-                nlohmann::json attributeJson;
-                attributeJson["id"] = attribute.id;
-                attributeJson["item_id"] = attribute.item_id;
-                attributeJson["name"] = attribute.name;
-                attributeJson["slug"] = attribute.slug;
-                attributeJson["value"] = attribute.value;
-                attributesArray.push_back(attributeJson);
+                rows.beginObject()
+                    .field("id", attribute.id)
+                    .field("item_id", attribute.item_id)
+                    .field("name", attribute.name)
+                    .field("slug", attribute.slug)
+                    .field("value", attribute.value)
+                    .endObject();
             }
-            itemJson["attributes"] = attributesArray;
+            rows.endArray();
 
             // Add use effects
-            nlohmann::json useEffectsArray = nlohmann::json::array();
+            rows.key("useEffects").beginArray();
             for (const auto &ue : itemData.useEffects)
             {
-                nlohmann::json ueJson;
-                ueJson["effectSlug"] = ue.effectSlug;
-                ueJson["attributeSlug"] = ue.attributeSlug;
-                ueJson["value"] = ue.value;
-                ueJson["isInstant"] = ue.isInstant;
-                ueJson["durationSeconds"] = ue.durationSeconds;
-                ueJson["tickMs"] = ue.tickMs;
-                ueJson["cooldownSeconds"] = ue.cooldownSeconds;
-                useEffectsArray.push_back(ueJson);
+                rows.beginObject()
+                    .field("effectSlug", ue.effectSlug)
+                    .field("attributeSlug", ue.attributeSlug)
+                    .field("value", ue.value)
+                    .field("isInstant", ue.isInstant)
+                    .field("durationSeconds", ue.durationSeconds)
+                    .field("tickMs", ue.tickMs)
+                    .field("cooldownSeconds", ue.cooldownSeconds)
+                    .endObject();
             }
-            itemJson["useEffects"] = useEffectsArray;
+            rows.endArray();
 
             // Social systems (Stage 4, migration 039)
-            itemJson["masterySlug"] = itemData.masterySlug;
+            rows.field("masterySlug", itemData.masterySlug);
 
-            // Add the current item to the items list json
-            itemsListJson.push_back(itemJson);
+            rows.endObject();
         }
+        rows.endArray();
 
         // Build response
-        nlohmann::json response = ResponseBuilder()
-                                      .setHeader("message", "Items list success!")
-                                      .setHeader("hash", "")
-                                      .setHeader("clientId", clientID)
-                                      .setHeader("eventType", "getItemsList")
-                                      .setBody("itemsList", itemsListJson)
-                                      .build();
+        nlohmann::json header = ResponseBuilder()
+                                    .setHeader("message", "Items list success!")
+                                    .setHeader("hash", "")
+                                    .setHeader("clientId", clientID)
+                                    .setHeader("eventType", "getItemsList")
+                                    .build()["header"];
 
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, itemsStream.finish("success", header));
     }
     catch (const std::exception &e)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Error getting items list: " + std::string(e.what()));
     }
 }
@@ -1659,8 +1690,6 @@ EventHandler::handleGetItemsListEvent(const Event &event)
 void
 EventHandler::handleGetMobLootInfoEvent(const Event &event)
 {
-    // Retrieve the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
@@ -1699,11 +1728,11 @@ EventHandler::handleGetMobLootInfoEvent(const Event &event)
                                       .setBody("mobLootInfo", mobLootListJson)
                                       .build();
 
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
     }
     catch (const std::exception &e)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Error getting mob loot info: " + std::string(e.what()));
     }
 }
@@ -1719,11 +1748,11 @@ EventHandler::handlePingClientEvent(const Event &event)
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
 
-    log_->info("Handling PING event for client ID: " + std::to_string(clientID));
+    GS_LOG_DEBUG_SAMPLED(log_, 100, "Handling PING event for client ID: {}", clientID);
 
     if (!clientSocket || !clientSocket->is_open())
     {
-        log_->info("Skipping ping - socket is closed for client ID: " + std::to_string(clientID));
+        GS_LOG_INFO(log_, "Skipping ping - socket is closed for client ID: {}", clientID);
         return;
     }
 
@@ -1732,7 +1761,7 @@ EventHandler::handlePingClientEvent(const Event &event)
         // Try to extract the data
         if (std::holds_alternative<ClientDataStruct>(data))
         {
-            ClientDataStruct passedClientData = std::get<ClientDataStruct>(data);
+            const ClientDataStruct &passedClientData = std::get<ClientDataStruct>(data);
 
             // Check if we have timestamps (for request-response lag compensation)
             TimestampStruct timestamps;
@@ -1763,13 +1792,10 @@ EventHandler::handlePingClientEvent(const Event &event)
                            .setBody("", "")
                            .build();
 
-            // Prepare a response message with timestamps
-            std::string responseData = networkManager_.generateResponseMessage("success", response, timestamps);
-
             // Send the response to the client
-            networkManager_.sendResponse(clientSocket, responseData);
+            networkManager_.sendResponseMessage(clientSocket, "success", response, timestamps);
 
-            log_->info("Sending PING response with timestamps to Client ID: " + std::to_string(clientID));
+            GS_LOG_DEBUG_SAMPLED(log_, 100, "Sending PING response with timestamps to Client ID: {}", clientID);
         }
         else
         {
@@ -1796,7 +1822,7 @@ EventHandler::handleGetCharacterExpForLevelEvent(const Event &event)
         // Извлекаем данные клиента из события
         if (std::holds_alternative<ClientDataStruct>(data))
         {
-            ClientDataStruct clientData = std::get<ClientDataStruct>(data);
+            const ClientDataStruct &clientData = std::get<ClientDataStruct>(data);
 
             // Парсим JSON данные из запроса, чтобы получить уровень
             std::string requestData = clientData.hash; // Используем hash поле для передачи JSON данных
@@ -1804,7 +1830,7 @@ EventHandler::handleGetCharacterExpForLevelEvent(const Event &event)
 
             int level = requestJson["body"]["level"].get<int>();
 
-            log_->debug("Requesting experience points for level: " + std::to_string(level));
+            GS_LOG_DEBUG(log_, "Requesting experience points for level: {}", level);
 
             // Получаем опыт для указанного уровня из базы данных
             int experiencePoints = 0;
@@ -1848,8 +1874,7 @@ EventHandler::handleGetCharacterExpForLevelEvent(const Event &event)
                                           .build();
 
             // Отправляем ответ чанк-серверу
-            std::string responseData = networkManager_.generateResponseMessage("success", response);
-            networkManager_.sendResponse(clientSocket, responseData);
+            networkManager_.sendResponseMessage(clientSocket, "success", response);
 
             log_->info("Sent experience data for level " + std::to_string(level) +
                        " to chunk server");
@@ -1865,8 +1890,7 @@ EventHandler::handleGetCharacterExpForLevelEvent(const Event &event)
                                                .setHeader("eventType", "getCharacterExpForLevel")
                                                .build();
 
-            std::string responseData = networkManager_.generateResponseMessage("error", errorResponse);
-            networkManager_.sendResponse(clientSocket, responseData);
+            networkManager_.sendResponseMessage(clientSocket, "error", errorResponse);
         }
     }
     catch (const std::exception &ex)
@@ -1880,8 +1904,7 @@ EventHandler::handleGetCharacterExpForLevelEvent(const Event &event)
                                            .setHeader("eventType", "getCharacterExpForLevel")
                                            .build();
 
-        std::string responseData = networkManager_.generateResponseMessage("error", errorResponse);
-        networkManager_.sendResponse(clientSocket, responseData);
+        networkManager_.sendResponseMessage(clientSocket, "error", errorResponse);
     }
 }
 
@@ -1899,7 +1922,7 @@ EventHandler::handleGetExpLevelTableEvent(const Event &event)
         // Извлекаем данные клиента из события
         if (std::holds_alternative<ClientDataStruct>(data))
         {
-            ClientDataStruct clientData = std::get<ClientDataStruct>(data);
+            const ClientDataStruct &clientData = std::get<ClientDataStruct>(data);
 
             log_->debug("Requesting experience level table from database");
 
@@ -1927,6 +1950,7 @@ EventHandler::handleGetExpLevelTableEvent(const Event &event)
             }
             catch (const std::exception &e)
             {
+                markCatalogResponseFailed();
                 gameServices_.getLogger().logError("Database error getting experience level table: " + std::string(e.what()));
                 expLevelTable = nlohmann::json::array(); // Пустой массив в случае ошибки
             }
@@ -1942,8 +1966,7 @@ EventHandler::handleGetExpLevelTableEvent(const Event &event)
                                           .build();
 
             // Отправляем ответ чанк-серверу
-            std::string responseData = networkManager_.generateResponseMessage("success", response);
-            networkManager_.sendResponse(clientSocket, responseData);
+            sendCatalogResponse(clientSocket, "success", response);
 
             gameServices_.getLogger().log("Sent experience level table (" + std::to_string(expLevelTable.size()) +
                                               " entries) to chunk server",
@@ -1960,12 +1983,12 @@ EventHandler::handleGetExpLevelTableEvent(const Event &event)
                                                .setHeader("eventType", "getExpLevelTable")
                                                .build();
 
-            std::string responseData = networkManager_.generateResponseMessage("error", errorResponse);
-            networkManager_.sendResponse(clientSocket, responseData);
+            sendCatalogResponse(clientSocket, "error", errorResponse);
         }
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Exception in handleGetExpLevelTableEvent: " + std::string(ex.what()));
 
         // Отправляем ошибку
@@ -1975,8 +1998,7 @@ EventHandler::handleGetExpLevelTableEvent(const Event &event)
                                            .setHeader("eventType", "getExpLevelTable")
                                            .build();
 
-        std::string responseData = networkManager_.generateResponseMessage("error", errorResponse);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "error", errorResponse);
     }
 }
 
@@ -1984,8 +2006,6 @@ EventHandler::handleGetExpLevelTableEvent(const Event &event)
 void
 EventHandler::handleGetNPCsListEvent(const Event &event)
 {
-    // Retrieve the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
@@ -1998,119 +2018,114 @@ EventHandler::handleGetNPCsListEvent(const Event &event)
         // Get the NPCs list from the database as map
         auto npcsListMap = gameServices_.getNPCManager().getNPCs();
 
-        nlohmann::json npcsListJson;
+        // Streamed straight into the response buffer: no per-NPC DOM, no envelope copies
+        ResponseStream npcsStream;
+        JsonStreamWriter &rows = npcsStream.body();
+        rows.key("npcsList").beginArray();
         for (const auto &npcItem : npcsListMap)
         {
             const NPCDataStruct &npcData = npcItem.second;
 
-            // Create a JSON object for the current NPC
-            nlohmann::json npcJson;
-            npcJson["id"] = npcData.id;
-            npcJson["name"] = npcData.name;
-            npcJson["slug"] = npcData.slug;
-            npcJson["race"] = npcData.raceName;
-            npcJson["level"] = npcData.level;
-            npcJson["currentHealth"] = npcData.currentHealth;
-            npcJson["currentMana"] = npcData.currentMana;
-            npcJson["maxMana"] = npcData.maxMana;
-            npcJson["maxHealth"] = npcData.maxHealth;
-            npcJson["npcType"] = npcData.npcType;
-            npcJson["isInteractable"] = npcData.isInteractable;
-            npcJson["dialogueId"] = npcData.dialogueId;
-            nlohmann::json questSlugsJson = nlohmann::json::array();
-            for (const auto &slug : npcData.questSlugs)
-                questSlugsJson.push_back(slug);
-            npcJson["questSlugs"] = questSlugsJson;
-            npcJson["factionSlug"] = npcData.factionSlug;
-            npcJson["posX"] = npcData.position.positionX;
-            npcJson["posY"] = npcData.position.positionY;
-            npcJson["posZ"] = npcData.position.positionZ;
-            npcJson["rotZ"] = npcData.position.rotationZ;
-
-            // Add the current item to the NPCs list json
-            npcsListJson.push_back(npcJson);
+            rows.beginObject();
+            rows.field("id", npcData.id);
+            rows.field("name", npcData.name);
+            rows.field("slug", npcData.slug);
+            rows.field("race", npcData.raceName);
+            rows.field("level", npcData.level);
+            rows.field("currentHealth", npcData.currentHealth);
+            rows.field("currentMana", npcData.currentMana);
+            rows.field("maxMana", npcData.maxMana);
+            rows.field("maxHealth", npcData.maxHealth);
+            rows.field("npcType", npcData.npcType);
+            rows.field("isInteractable", npcData.isInteractable);
+            rows.field("dialogueId", npcData.dialogueId);
+            rows.arrayField("questSlugs", npcData.questSlugs);
+            rows.field("factionSlug", npcData.factionSlug);
+            rows.field("posX", npcData.position.positionX);
+            rows.field("posY", npcData.position.positionY);
+            rows.field("posZ", npcData.position.positionZ);
+            rows.field("rotZ", npcData.position.rotationZ);
+
+            rows.endObject();
         }
+        rows.endArray();
 
         // If the NPCs list is empty, log a message
-        if (npcsListJson.empty())
+        if (npcsListMap.empty())
         {
             log_->info("NPCs list is empty!");
         }
 
-        // Prepare the response message
-        nlohmann::json response;
-        ResponseBuilder builder;
-
-        // Add the message to the response
-        response = builder
-                       .setHeader("message", "Getting NPCs list success!")
-                       .setHeader("hash", "")
-                       .setHeader("clientId", clientID)
-                       .setHeader("eventType", "setNPCsList")
-                       .setBody("npcsList", npcsListJson)
-                       .build();
-        // Prepare a response message
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
+        nlohmann::json header = ResponseBuilder()
+                                    .setHeader("message", "Getting NPCs list success!")
+                                    .setHeader("hash", "")
+                                    .setHeader("clientId", clientID)
+                                    .setHeader("eventType", "setNPCsList")
+                                    .build()["header"];
 
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, npcsStream.finish("success", header));
 
         // After sending NPCs list, send NPCs skills
-        nlohmann::json npcsSkillsJson;
+        ResponseStream skillsStream;
+        JsonStreamWriter &skillRows = skillsStream.body();
+        std::size_t npcSkillCount = 0;
+        skillRows.key("npcsSkillsList").beginArray();
         for (const auto &npcItem : npcsListMap)
         {
             const NPCDataStruct &npcData = npcItem.second;
 
             for (const auto &skill : npcData.skills)
             {
-                nlohmann::json skillJson;
-                skillJson["npc_id"] = npcData.id;
-                skillJson["skillName"] = skill.skillName;
-                skillJson["skillSlug"] = skill.skillSlug;
-                skillJson["scaleStat"] = skill.scaleStat;
-                skillJson["school"] = skill.school;
-                skillJson["skillEffectType"] = skill.skillEffectType;
-                skillJson["skillLevel"] = skill.skillLevel;
-                skillJson["coeff"] = skill.coeff;
-                skillJson["flatAdd"] = skill.flatAdd;
-                skillJson["cooldownMs"] = skill.cooldownMs;
-                skillJson["gcdMs"] = skill.gcdMs;
-                skillJson["castMs"] = skill.castMs;
-                skillJson["costMp"] = skill.costMp;
-                skillJson["maxRange"] = skill.maxRange;
-                skillJson["areaRadius"] = skill.areaRadius;
-                skillJson["swingMs"] = skill.swingMs;
-                skillJson["animationName"] = skill.animationName;
-
-                npcsSkillsJson.push_back(skillJson);
+                ++npcSkillCount;
+                skillRows.beginObject();
+                skillRows.field("npc_id", npcData.id);
+                skillRows.field("skillName", skill.skillName);
+                skillRows.field("skillSlug", skill.skillSlug);
+                skillRows.field("scaleStat", skill.scaleStat);
+                skillRows.field("school", skill.school);
+                skillRows.field("skillEffectType", skill.skillEffectType);
+                skillRows.field("skillLevel", skill.skillLevel);
+                skillRows.field("coeff", skill.coeff);
+                skillRows.field("flatAdd", skill.flatAdd);
+                skillRows.field("cooldownMs", skill.cooldownMs);
+                skillRows.field("gcdMs", skill.gcdMs);
+                skillRows.field("castMs", skill.castMs);
+                skillRows.field("costMp", skill.costMp);
+                skillRows.field("maxRange", skill.maxRange);
+                skillRows.field("areaRadius", skill.areaRadius);
+                skillRows.field("swingMs", skill.swingMs);
+                skillRows.field("animationName", skill.animationName);
+
+                skillRows.endObject();
             }
         }
+        skillRows.endArray();
 
         // If the NPCs skills list is empty, log a message
-        if (npcsSkillsJson.empty())
+        if (npcSkillCount == 0)
         {
             log_->info("NPCs skills list is empty!");
         }
 
-        // Add the message to the response
-        response = builder
-                       .setHeader("message", "Getting NPCs skills list success!")
-                       .setHeader("hash", "")
-                       .setHeader("clientId", clientID)
-                       .setHeader("eventType", "setNPCsSkills")
-                       .setBody("npcsSkillsList", npcsSkillsJson)
-                       .build();
-        responseData = networkManager_.generateResponseMessage("success", response);
+        nlohmann::json skillsHeader = ResponseBuilder()
+                                          .setHeader("message", "Getting NPCs skills list success!")
+                                          .setHeader("hash", "")
+                                          .setHeader("clientId", clientID)
+                                          .setHeader("eventType", "setNPCsSkills")
+                                          .build()["header"];
 
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, skillsStream.finish("success", skillsHeader));
     }
     catch (const std::bad_variant_access &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Error in handleGetNPCsListEvent: " + std::string(ex.what()));
     }
 }
@@ -2119,8 +2134,6 @@ EventHandler::handleGetNPCsListEvent(const Event &event)
 void
 EventHandler::handleGetNPCsAttributesEvent(const Event &event)
 {
-    // Retrieve the data from the event
-    const auto &data = event.getData();
     int clientID = event.getClientID();
     // get socket from the event
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
@@ -2167,18 +2180,17 @@ EventHandler::handleGetNPCsAttributesEvent(const Event &event)
                        .setHeader("eventType", "setNPCsAttributes")
                        .setBody("npcsAttributesList", npcsAttributesListJson)
                        .build();
-        // Prepare a response message
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-
         // Send the response to the client
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
     }
     catch (const std::bad_variant_access &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().log("Error here: " + std::string(ex.what()));
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Error in handleGetNPCsAttributesEvent: " + std::string(ex.what()));
     }
 }
@@ -2204,23 +2216,12 @@ EventHandler::handleSavePositionsEvent(const Event &event)
             return;
         }
 
-        int savedCount = 0;
+        // Queued for the write-behind flush; a character moving between flushes is written once
+        auto &characterManager = gameServices_.getCharacterManager();
         for (const auto &charData : charactersList)
-        {
-            if (charData.characterId <= 0)
-                continue;
-
-            gameServices_.getCharacterManager().updateCharacterPosition(
-                gameServices_.getDatabase(),
-                0, // accountId not needed here
-                charData.characterId,
-                charData.characterPosition);
+            characterManager.markPositionDirty(charData.characterId, charData.characterPosition);
 
-            ++savedCount;
-        }
-
-        gameServices_.getLogger().log(
-            "Periodic position save: persisted " + std::to_string(savedCount) + " character(s) to DB", GREEN);
+        GS_LOG_DEBUG(log_, "Periodic position save: queued {} character(s)", charactersList.size());
     }
     catch (const std::exception &ex)
     {
@@ -2246,21 +2247,11 @@ EventHandler::handleSaveHpManaEvent(const Event &event)
         if (charactersList.empty())
             return;
 
-        int savedCount = 0;
+        auto &characterManager = gameServices_.getCharacterManager();
         for (const auto &charData : charactersList)
-        {
-            if (charData.characterId <= 0)
-                continue;
-            gameServices_.getCharacterManager().saveCharacterHpMana(
-                gameServices_.getDatabase(),
-                charData.characterId,
-                charData.characterCurrentHealth,
-                charData.characterCurrentMana);
-            ++savedCount;
-        }
+            characterManager.markHpManaDirty(charData.characterId, charData.characterCurrentHealth, charData.characterCurrentMana);
 
-        gameServices_.getLogger().log(
-            "[SAVE_HP_MANA] Persisted HP/Mana for " + std::to_string(savedCount) + " character(s)", GREEN);
+        GS_LOG_DEBUG(log_, "[SAVE_HP_MANA] Queued HP/Mana for {} character(s)", charactersList.size());
     }
     catch (const std::exception &ex)
     {
@@ -2290,39 +2281,45 @@ EventHandler::handleSaveInventoryChangeEvent(const Event &event)
             return;
 
         std::shared_ptr<boost::asio::ip::tcp::socket> chunkSocket = event.getClientSocket();
+        auto &inventoryWriteBehind = gameServices_.getInventoryWriteBehind();
+
+        if (quantity > 0 && inventoryItemId > 0)
+        {
+            // Row already exists in DB — the new quantity goes out with the next
+            // write-behind flush. No id sync needed — the id didn't change.
+            inventoryWriteBehind.markQuantityDirty(characterId, inventoryItemId, quantity);
+            GS_LOG_DEBUG(log_, "[SAVE_INVENTORY] character={} item={} qty={} (deferred)", characterId, itemId, quantity);
+            return;
+        }
+
+        // The statements below address the row by (character, item) or delete it, so the
+        // pending updates must not land after them. Barriers run before our connection
+        // is taken: they use one of their own.
+        if (inventoryItemId > 0)
+            inventoryWriteBehind.discardItem(inventoryItemId);
+        else
+            inventoryWriteBehind.flushCharacter(gameServices_.getDatabase(), characterId);
 
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
         if (quantity > 0)
         {
-            if (inventoryItemId > 0)
-            {
-                // Row already exists in DB — UPDATE quantity in-place, no new row.
-                gameServices_.getDatabase().executeQueryWithTransaction(
-                    txn, "update_player_inventory_quantity", {quantity, inventoryItemId, characterId});
-                txn.commit();
-                // No id sync needed — the id didn't change.
-            }
-            else
-            {
-                // New item — INSERT and send assigned id back to chunk server.
-                auto result = gameServices_.getDatabase().executeQueryWithTransaction(
-                    txn, "upsert_player_inventory_item", {characterId, itemId, quantity});
-                txn.commit();
+            // New item — INSERT and send assigned id back to chunk server.
+            auto result = gameServices_.getDatabase().executeQueryWithTransaction(
+                txn, "upsert_player_inventory_item", {characterId, itemId, quantity});
+            txn.commit();
 
-                // Send back the assigned player_inventory.id so chunk server can fix in-memory id=0
-                if (!result.empty() && chunkSocket && chunkSocket->is_open())
-                {
-                    int64_t assignedId = result[0]["id"].as<int64_t>();
-                    nlohmann::json syncPkt;
-                    syncPkt["header"]["eventType"] = "inventoryItemIdSync";
-                    syncPkt["header"]["clientId"] = 0;
-                    syncPkt["body"]["characterId"] = characterId;
-                    syncPkt["body"]["itemId"] = itemId;
-                    syncPkt["body"]["inventoryItemId"] = assignedId;
-                    networkManager_.sendResponse(chunkSocket,
-                        networkManager_.generateResponseMessage("success", syncPkt));
-                }
+            // Send back the assigned player_inventory.id so chunk server can fix in-memory id=0
+            if (!result.empty() && chunkSocket && chunkSocket->is_open())
+            {
+                int64_t assignedId = result[0]["id"].as<int64_t>();
+                nlohmann::json syncPkt;
+                syncPkt["header"]["eventType"] = "inventoryItemIdSync";
+                syncPkt["header"]["clientId"] = 0;
+                syncPkt["body"]["characterId"] = characterId;
+                syncPkt["body"]["itemId"] = itemId;
+                syncPkt["body"]["inventoryItemId"] = assignedId;
+                networkManager_.sendResponseMessage(chunkSocket, "success", syncPkt);
             }
         }
         else
@@ -2341,8 +2338,7 @@ EventHandler::handleSaveInventoryChangeEvent(const Event &event)
             }
             txn.commit();
         }
-        log_->info("[SAVE_INVENTORY] character=" + std::to_string(characterId) +
-                   " item=" + std::to_string(itemId) + " qty=" + std::to_string(quantity));
+        GS_LOG_INFO(log_, "[SAVE_INVENTORY] character={} item={} qty={}", characterId, itemId, quantity);
     }
     catch (const std::exception &ex)
     {
@@ -2365,6 +2361,9 @@ EventHandler::handleGetPlayerInventoryEvent(const Event &event)
         }
         int characterId = std::get<int>(data);
 
+        // Read-your-writes: pending quantity/durability/kill count go out before the SELECT
+        gameServices_.getInventoryWriteBehind().flushCharacter(gameServices_.getDatabase(), characterId);
+
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
         auto result = gameServices_.getDatabase().executeQueryWithTransaction(
@@ -2393,8 +2392,7 @@ EventHandler::handleGetPlayerInventoryEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("items", itemsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(itemsJson.size()) +
                                           " inventory items for characterId=" + std::to_string(characterId),
@@ -2433,17 +2431,14 @@ EventHandler::handleSaveCharacterProgressEvent(const Event &event)
             if (charData.characterId <= 0 || charData.characterLevel <= 0)
                 continue;
 
-            gameServices_.getCharacterManager().updateCharacterExperienceAndLevel(
-                gameServices_.getDatabase(),
+            gameServices_.getCharacterManager().markExperienceDirty(
                 charData.characterId,
                 charData.characterExperiencePoints,
                 charData.characterLevel);
             ++savedCount;
         }
 
-        gameServices_.getLogger().log(
-            "Instant character progress save: persisted " + std::to_string(savedCount) + " character(s) exp/level to DB",
-            GREEN);
+        GS_LOG_DEBUG(log_, "Character progress save: queued exp/level for {} character(s)", savedCount);
     }
     catch (const std::exception &ex)
     {
@@ -2474,7 +2469,7 @@ EventHandler::handleGetDialoguesEvent(const Event &event)
                                    .setHeader("eventType", "setDialoguesData")
                                    .setBody("dialogues", dialoguesJson)
                                    .build();
-        networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", resp1));
+        sendCatalogResponse(clientSocket, "success", resp1);
 
         nlohmann::json resp2 = builder
                                    .setHeader("message", "NPC dialogue mappings")
@@ -2483,7 +2478,7 @@ EventHandler::handleGetDialoguesEvent(const Event &event)
                                    .setHeader("eventType", "setNPCDialogueMappings")
                                    .setBody("mappings", mappingsJson)
                                    .build();
-        networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", resp2));
+        sendCatalogResponse(clientSocket, "success", resp2);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(dialoguesJson.size()) +
                                           " dialogues + " + std::to_string(mappingsJson.size()) + " mappings to chunk",
@@ -2491,6 +2486,7 @@ EventHandler::handleGetDialoguesEvent(const Event &event)
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Error in handleGetDialoguesEvent: " + std::string(ex.what()));
     }
 }
@@ -2513,7 +2509,7 @@ EventHandler::handleGetQuestsEvent(const Event &event)
                                       .setHeader("eventType", "setQuestsData")
                                       .setBody("quests", questsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(questsJson.size()) +
                                           " quests to chunk",
@@ -2521,6 +2517,7 @@ EventHandler::handleGetQuestsEvent(const Event &event)
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("Error in handleGetQuestsEvent: " + std::string(ex.what()));
     }
 }
@@ -2551,7 +2548,7 @@ EventHandler::handleGetPlayerQuestsEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("quests", questsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(questsJson.size()) +
                                           " quests for characterId=" + std::to_string(characterId),
@@ -2589,7 +2586,7 @@ EventHandler::handleGetPlayerFlagsEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("flags", flagsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(flagsJson.size()) +
                                           " flags for characterId=" + std::to_string(characterId),
@@ -2705,14 +2702,14 @@ EventHandler::handleGetGameConfigEvent(const Event &event)
                                       .setBody("configList", configListJson)
                                       .build();
 
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
 
         gameServices_.getLogger().log("Sent game config (" +
                                       std::to_string(configMap.size()) + " entries) to chunk-server.");
     }
     catch (const std::exception &e)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetGameConfigEvent error: " + std::string(e.what()));
     }
 }
@@ -2734,9 +2731,7 @@ EventHandler::handleGetPlayerActiveEffectsEvent(const Event &event)
 
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
-        // Prune expired rows first to prevent unbounded table growth.
-        gameServices_.getDatabase().executeQueryWithTransaction(
-            txn, "cleanup_expired_active_effects", {});
+        // Expired rows are filtered here and pruned by the periodic cleanup task (see main.cpp)
         auto result = gameServices_.getDatabase().executeQueryWithTransaction(
             txn, "get_player_active_effects", {characterId});
 
@@ -2799,8 +2794,7 @@ EventHandler::handleGetPlayerActiveEffectsEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("effects", effectsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(effectsJson.size()) +
                                           " active effects for characterId=" + std::to_string(characterId),
@@ -2827,19 +2821,21 @@ EventHandler::handleGetCharacterAttributesRefreshEvent(const Event &event)
         }
         int characterId = std::get<int>(data);
 
-        auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-        auto result = gameServices_.getDatabase().executeQueryWithTransaction(
-            txn, "get_character_attributes", {characterId});
+        // Computed from cached inputs; only the first refresh of an uncached character reads
+        // the DB, and then it must see the pending durability values
+        if (!gameServices_.getCharacterAttributeService().isCached(characterId))
+            gameServices_.getInventoryWriteBehind().flushCharacter(gameServices_.getDatabase(), characterId);
+        const auto attributes = gameServices_.getCharacterAttributeService().getAttributes(
+            gameServices_.getDatabase(), characterId);
 
         nlohmann::json attrsJson = nlohmann::json::array();
-        for (const auto &row : result)
+        for (const auto &attribute : attributes)
         {
             nlohmann::json attr;
-            attr["id"] = row["id"].as<int>();
-            attr["name"] = row["name"].as<std::string>();
-            attr["slug"] = row["slug"].as<std::string>();
-            attr["value"] = row["value"].as<int>();
+            attr["id"] = attribute.id;
+            attr["name"] = attribute.name;
+            attr["slug"] = attribute.slug;
+            attr["value"] = attribute.value;
             attrsJson.push_back(std::move(attr));
         }
 
@@ -2852,8 +2848,7 @@ EventHandler::handleGetCharacterAttributesRefreshEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("attributesData", attrsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent " + std::to_string(attrsJson.size()) +
                                           " attribute entries (refresh) for characterId=" + std::to_string(characterId),
@@ -2917,14 +2912,14 @@ EventHandler::handleGetVendorDataEvent(const Event &event)
                                       .setBody("vendors", vendorList)
                                       .build();
 
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent vendor data: " +
                                       std::to_string(vendorList.size()) + " vendors.");
     }
     catch (const std::exception &e)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetVendorDataEvent error: " + std::string(e.what()));
     }
 }
@@ -2985,14 +2980,14 @@ EventHandler::handleGetTrainerDataEvent(const Event &event)
                                       .setBody("trainers", trainerList)
                                       .build();
 
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         gameServices_.getLogger().log("[EH] Sent trainer data: " +
                                       std::to_string(trainerList.size()) + " trainers.");
     }
     catch (const std::exception &e)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetTrainerDataEvent error: " + std::string(e.what()));
     }
 }
@@ -3017,15 +3012,11 @@ EventHandler::handleSaveDurabilityChangeEvent(const Event &event)
         if (characterId <= 0 || inventoryItemId <= 0)
             return;
 
-        auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-        gameServices_.getDatabase().executeQueryWithTransaction(
-            txn, "update_durability_current", {durabilityCurrent, inventoryItemId, characterId});
-        txn.commit();
+        // Changes on almost every hit: merged per item and written by the inventory write-behind flush
+        gameServices_.getInventoryWriteBehind().markDurabilityDirty(characterId, inventoryItemId, durabilityCurrent);
+        gameServices_.getCharacterAttributeService().setItemDurability(characterId, inventoryItemId, durabilityCurrent);
 
-        log_->info("[SAVE_DUR] char=" + std::to_string(characterId) +
-                   " item=" + std::to_string(inventoryItemId) +
-                   " dur=" + std::to_string(durabilityCurrent));
+        GS_LOG_DEBUG(log_, "[SAVE_DUR] char={} item={} dur={}", characterId, inventoryItemId, durabilityCurrent);
     }
     catch (const std::exception &ex)
     {
@@ -3062,9 +3053,8 @@ EventHandler::handleSaveCurrencyTransactionEvent(const Event &event)
             txn, "insert_currency_transaction", {characterId, npcId, totalPrice, txType});
         txn.commit();
 
-        log_->info("[CURRENCY_TX] char=" + std::to_string(characterId) +
-                   " type=" + txType + " item=" + std::to_string(itemId) +
-                   " qty=" + std::to_string(quantity) + " price=" + std::to_string(totalPrice));
+        GS_LOG_INFO(log_, "[CURRENCY_TX] char={} type={} item={} qty={} price={}",
+                    characterId, txType, itemId, quantity, totalPrice);
     }
     catch (const std::exception &ex)
     {
@@ -3093,35 +3083,43 @@ EventHandler::handleSaveEquipmentChangeEvent(const Event &event)
         if (characterId <= 0 || inventoryItemId <= 0 || action.empty())
             return;
 
-        auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-
-        if (action == "equip")
-        {
-            if (equipSlotSlug.empty())
-            {
-                log_->error("[SAVE_EQUIP] equipSlotSlug is empty for char=" + std::to_string(characterId));
-                return;
-            }
-            gameServices_.getDatabase().executeQueryWithTransaction(
-                txn, "insert_character_equipment", {characterId, equipSlotSlug, inventoryItemId});
-        }
-        else if (action == "unequip")
+        if (action == "equip" && equipSlotSlug.empty())
         {
-            gameServices_.getDatabase().executeQueryWithTransaction(
-                txn, "delete_character_equipment", {characterId, inventoryItemId});
+            log_->error("[SAVE_EQUIP] equipSlotSlug is empty for char=" + std::to_string(characterId));
+            return;
         }
-        else
+        if (action != "equip" && action != "unequip")
         {
             log_->error("[SAVE_EQUIP] Unknown action: " + action);
             return;
         }
-        txn.commit();
 
-        log_->info("[SAVE_EQUIP] char=" + std::to_string(characterId) +
-                   " action=" + action +
-                   " slot=" + equipSlotSlug +
-                   " invItemId=" + std::to_string(inventoryItemId));
+        // equipItem() reads the row's durability back, so pending values are written first
+        if (action == "equip")
+            gameServices_.getInventoryWriteBehind().flushItem(gameServices_.getDatabase(), inventoryItemId);
+
+        {
+            auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
+            pqxx::work txn(_dbConn.get());
+            if (action == "equip")
+                gameServices_.getDatabase().executeQueryWithTransaction(
+                    txn, "insert_character_equipment", {characterId, equipSlotSlug, inventoryItemId});
+            else
+                gameServices_.getDatabase().executeQueryWithTransaction(
+                    txn, "delete_character_equipment", {characterId, inventoryItemId});
+            txn.commit();
+        }
+
+        // Keep the cached attribute inputs in step with character_equipment. The connection
+        // is released first: equipItem() takes its own for the item lookup.
+        auto &attributeService = gameServices_.getCharacterAttributeService();
+        if (action == "equip")
+            attributeService.equipItem(gameServices_.getDatabase(), characterId, equipSlotSlug, inventoryItemId);
+        else
+            attributeService.unequipItem(characterId, inventoryItemId);
+
+        GS_LOG_INFO(log_, "[SAVE_EQUIP] char={} action={} slot={} invItemId={}",
+                    characterId, action, equipSlotSlug, inventoryItemId);
     }
     catch (const std::exception &ex)
     {
@@ -3176,13 +3174,13 @@ EventHandler::handleGetRespawnZonesEvent(const Event &event)
                                       .setHeader("eventType", "setRespawnZonesList")
                                       .setBody("respawnZonesData", zonesJson)
                                       .build();
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[RESPAWN_ZONES] Sent " + std::to_string(zonesJson.size()) + " respawn zones to chunk server");
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetRespawnZonesEvent error: " + std::string(ex.what()));
     }
 }
@@ -3229,13 +3227,13 @@ EventHandler::handleGetClassSpawnZonesEvent(const Event &event)
                                       .setHeader("eventType", "setClassSpawnZonesList")
                                       .setBody("classSpawnZonesData", zonesJson)
                                       .build();
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[CLASS_SPAWN_ZONES] Sent " + std::to_string(zonesJson.size()) + " class spawn zones to chunk server");
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetClassSpawnZonesEvent error: " + std::string(ex.what()));
     }
 }
@@ -3254,12 +3252,9 @@ EventHandler::handleSaveExperienceDebtEvent(const Event &event)
         if (characterId <= 0)
             return;
 
-        auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-        gameServices_.getDatabase().executeQueryWithTransaction(txn, "set_character_experience_debt", {characterId, debt});
-        txn.commit();
+        gameServices_.getCharacterManager().markExperienceDebtDirty(characterId, debt);
 
-        log_->info("[SAVE_EXP_DEBT] char=" + std::to_string(characterId) + " debt=" + std::to_string(debt));
+        GS_LOG_DEBUG(log_, "[SAVE_EXP_DEBT] char={} debt={}", characterId, debt);
     }
     catch (const std::exception &ex)
     {
@@ -3306,7 +3301,7 @@ EventHandler::handleSaveActiveEffectEvent(const Event &event)
             txn, "insert_player_active_effect", params);
         txn.commit();
 
-        log_->info("[SAVE_ACTIVE_EFFECT] char=" + std::to_string(characterId) + " effect=" + effectSlug);
+        GS_LOG_INFO(log_, "[SAVE_ACTIVE_EFFECT] char={} effect={}", characterId, effectSlug);
     }
     catch (const std::exception &ex)
     {
@@ -3334,15 +3329,9 @@ EventHandler::handleSaveItemKillCountEvent(const Event &event)
         if (characterId <= 0 || inventoryItemId <= 0)
             return;
 
-        auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-        gameServices_.getDatabase().executeQueryWithTransaction(
-            txn, "update_item_kill_count", {killCount, inventoryItemId, characterId});
-        txn.commit();
+        gameServices_.getInventoryWriteBehind().markKillCountDirty(characterId, inventoryItemId, killCount);
 
-        log_->info("[SAVE_KILL_COUNT] char=" + std::to_string(characterId) +
-                   " item=" + std::to_string(inventoryItemId) +
-                   " kills=" + std::to_string(killCount));
+        GS_LOG_DEBUG(log_, "[SAVE_KILL_COUNT] char={} item={} kills={}", characterId, inventoryItemId, killCount);
     }
     catch (const std::exception &ex)
     {
@@ -3370,6 +3359,14 @@ EventHandler::handleTransferInventoryItemEvent(const Event &event)
         if (toCharId <= 0 || inventoryItemId <= 0)
             return;
 
+        // Pending updates are checked against the current owner, so they go out before the row
+        // changes hands; if they cannot, they are dropped — the move itself must still happen
+        if (!gameServices_.getInventoryWriteBehind().flushItem(gameServices_.getDatabase(), inventoryItemId))
+        {
+            log_->warn("transferInventoryItem: pending updates of invItem={} could not be written, dropping them", inventoryItemId);
+            gameServices_.getInventoryWriteBehind().discardItem(inventoryItemId);
+        }
+
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
         if (fromCharId > 0)
@@ -3385,10 +3382,10 @@ EventHandler::handleTransferInventoryItemEvent(const Event &event)
                 txn, "transfer_item_ownership", {toCharId, inventoryItemId});
         }
         txn.commit();
+        gameServices_.getCharacterAttributeService().forgetInventoryItem(inventoryItemId);
 
-        log_->info("[TRANSFER_ITEM] to=" + std::to_string(toCharId) +
-                   " invItem=" + std::to_string(inventoryItemId) +
-                   (fromCharId > 0 ? " from=" + std::to_string(fromCharId) : " (ground)"));
+        GS_LOG_INFO(log_, "[TRANSFER_ITEM] to={} invItem={} {}", toCharId, inventoryItemId,
+                    fromCharId > 0 ? "from=" + std::to_string(fromCharId) : "(ground)");
     }
     catch (const std::exception &ex)
     {
@@ -3410,14 +3407,22 @@ EventHandler::handleNullifyItemOwnerEvent(const Event &event)
         if (inventoryItemId <= 0 || fromCharId <= 0)
             return;
 
+        // Pending updates are checked against the current owner, so they go out before the row
+        // changes hands; if they cannot, they are dropped — the move itself must still happen
+        if (!gameServices_.getInventoryWriteBehind().flushItem(gameServices_.getDatabase(), inventoryItemId))
+        {
+            log_->warn("nullifyItemOwner: pending updates of invItem={} could not be written, dropping them", inventoryItemId);
+            gameServices_.getInventoryWriteBehind().discardItem(inventoryItemId);
+        }
+
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
         gameServices_.getDatabase().executeQueryWithTransaction(
             txn, "nullify_item_owner", {inventoryItemId, fromCharId});
         txn.commit();
+        gameServices_.getCharacterAttributeService().forgetInventoryItem(inventoryItemId);
 
-        log_->info("[NULLIFY_OWNER] char=" + std::to_string(fromCharId) +
-                   " invItem=" + std::to_string(inventoryItemId));
+        GS_LOG_INFO(log_, "[NULLIFY_OWNER] char={} invItem={}", fromCharId, inventoryItemId);
     }
     catch (const std::exception &ex)
     {
@@ -3438,13 +3443,17 @@ EventHandler::handleDeleteInventoryItemEvent(const Event &event)
         if (inventoryItemId <= 0)
             return;
 
+        // The row is going away, so its pending updates are dropped rather than written
+        gameServices_.getInventoryWriteBehind().discardItem(inventoryItemId);
+
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
         gameServices_.getDatabase().executeQueryWithTransaction(
             txn, "delete_inventory_item_by_id", {inventoryItemId});
         txn.commit();
+        gameServices_.getCharacterAttributeService().forgetInventoryItem(inventoryItemId);
 
-        log_->info("[DELETE_ITEM] invItem=" + std::to_string(inventoryItemId));
+        GS_LOG_INFO(log_, "[DELETE_ITEM] invItem={}", inventoryItemId);
     }
     catch (const std::exception &ex)
     {
@@ -3514,13 +3523,13 @@ EventHandler::handleGetStatusEffectTemplatesEvent(const Event &event)
                                       .setHeader("eventType", "setStatusEffectTemplates")
                                       .setBody("templates", effectsJson)
                                       .build();
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[STATUS_EFFECT_TEMPLATES] Sent " + std::to_string(effectsJson.size()) + " templates to chunk server");
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetStatusEffectTemplatesEvent error: " + std::string(ex.what()));
     }
 }
@@ -3571,13 +3580,13 @@ EventHandler::handleGetGameZonesEvent(const Event &event)
                                       .setHeader("eventType", "setGameZonesList")
                                       .setBody("gameZonesData", zonesJson)
                                       .build();
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[GAME_ZONES] Sent " + std::to_string(zonesJson.size()) + " game zones to chunk server");
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetGameZonesEvent error: " + std::string(ex.what()));
     }
 }
@@ -3621,8 +3630,7 @@ EventHandler::handleGetPlayerPityEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("entries", entriesJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[EH] Sent " + std::to_string(entriesJson.size()) +
                    " pity counters for characterId=" + std::to_string(characterId));
@@ -3672,8 +3680,7 @@ EventHandler::handleGetPlayerBestiaryEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("entries", entriesJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[EH] Sent " + std::to_string(entriesJson.size()) +
                    " bestiary entries for characterId=" + std::to_string(characterId));
@@ -3711,9 +3718,7 @@ EventHandler::handleSavePityCounterEvent(const Event &event)
             txn, "upsert_pity_counter", {characterId, itemId, killCount});
         txn.commit();
 
-        log_->info("[SAVE_PITY] char=" + std::to_string(characterId) +
-                   " item=" + std::to_string(itemId) +
-                   " kills=" + std::to_string(killCount));
+        GS_LOG_INFO(log_, "[SAVE_PITY] char={} item={} kills={}", characterId, itemId, killCount);
     }
     catch (const std::exception &ex)
     {
@@ -3748,9 +3753,7 @@ EventHandler::handleSaveBestiaryKillEvent(const Event &event)
             txn, "upsert_bestiary_kill", {characterId, mobTemplateId, killCount});
         txn.commit();
 
-        log_->info("[SAVE_BESTIARY] char=" + std::to_string(characterId) +
-                   " mob=" + std::to_string(mobTemplateId) +
-                   " kills=" + std::to_string(killCount));
+        GS_LOG_INFO(log_, "[SAVE_BESTIARY] char={} mob={} kills={}", characterId, mobTemplateId, killCount);
     }
     catch (const std::exception &ex)
     {
@@ -3797,13 +3800,13 @@ EventHandler::handleGetTimedChampionTemplatesEvent(const Event &event)
                                       .setBody("timedChampionTemplates", arr)
                                       .build();
 
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
-        networkManager_.sendResponse(clientSocket, responseData);
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[TIMED_CHAMP] Sent {} timed champion templates to chunk server", arr.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetTimedChampionTemplatesEvent error: " + std::string(ex.what()));
     }
 }
@@ -3893,8 +3896,7 @@ EventHandler::handleGetPlayerReputationsEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("entries", entriesJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[REPUTATION] Sent {} entries for characterId={}", entriesJson.size(), characterId);
     }
@@ -3978,8 +3980,7 @@ EventHandler::handleGetPlayerMasteriesEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("entries", entriesJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[MASTERY] Sent {} entries for characterId={}", entriesJson.size(), characterId);
     }
@@ -4060,13 +4061,13 @@ EventHandler::handleGetMasteryDefinitionsEvent(const Event &event)
                                       .setHeader("eventType", "setMasteryDefinitionsData")
                                       .setBody("definitions", defsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[MASTERY] Sent {} mastery definitions to chunk server", defsJson.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetMasteryDefinitionsEvent error: " + std::string(ex.what()));
     }
 }
@@ -4096,6 +4097,14 @@ EventHandler::handleSaveLearnedSkillEvent(const Event &event)
             return;
         }
 
+        // A deferred level-up grants its skill points at flush time; it must land before the
+        // decrement below, which clamps against the stored balance. The skill is saved either
+        // way — the learn already happened on the chunk server.
+        if (!gameServices_.getCharacterManager().flushCharacter(gameServices_.getDatabase(), characterId))
+            log_->warn("handleSaveLearnedSkillEvent: pending state of char={} not written yet, "
+                       "cost of skill {} is checked against the stored skill points",
+                characterId, skillSlug);
+
         auto _dbConn = gameServices_.getDatabase().getConnectionLocked();
         pqxx::work txn(_dbConn.get());
 
@@ -4209,8 +4218,7 @@ EventHandler::handleSaveLearnedSkillEvent(const Event &event)
                                       .setBody("skillData", skillJson)
                                       .build();
 
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[SKILL] Saved learned skill slug={} for char={}", skillSlug, characterId);
     }
@@ -4312,13 +4320,13 @@ EventHandler::handleGetZoneEventTemplatesEvent(const Event &event)
                                       .setHeader("eventType", "setZoneEventTemplatesList")
                                       .setBody("templates", arr)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[ZONE_EVENT] Sent {} zone event templates to chunk server", arr.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetZoneEventTemplatesEvent error: " + std::string(ex.what()));
     }
 }
@@ -4355,6 +4363,7 @@ EventHandler::handleGetTitleDefinitionsEvent(const Event &event)
             }
             catch (...)
             {
+                markCatalogResponseFailed();
                 t["bonuses"] = nlohmann::json::array();
             }
             // conditionParams is JSONB — parse it back to a JSON object
@@ -4364,6 +4373,7 @@ EventHandler::handleGetTitleDefinitionsEvent(const Event &event)
             }
             catch (...)
             {
+                markCatalogResponseFailed();
                 t["conditionParams"] = nlohmann::json::object();
             }
             titlesJson.push_back(std::move(t));
@@ -4377,13 +4387,13 @@ EventHandler::handleGetTitleDefinitionsEvent(const Event &event)
                                       .setHeader("eventType", "setTitleDefinitionsData")
                                       .setBody("titles", titlesJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[TITLE] Sent {} title definitions to chunk server", titlesJson.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetTitleDefinitionsEvent error: " + std::string(ex.what()));
     }
 }
@@ -4429,8 +4439,7 @@ EventHandler::handleGetPlayerTitlesEvent(const Event &event)
                                       .setBody("earnedSlugs", earnedSlugs)
                                       .setBody("equippedSlug", equippedSlug)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[TITLE] Sent {} earned titles for characterId={}", earnedSlugs.size(), characterId);
     }
@@ -4532,13 +4541,13 @@ EventHandler::handleGetEmoteDefinitionsEvent(const Event &event)
                                       .setHeader("eventType", "setEmoteDefinitionsData")
                                       .setBody("emotes", emotesJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[EMOTE] Sent {} emote definitions to chunk server", emotesJson.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetEmoteDefinitionsEvent error: " + std::string(ex.what()));
     }
 }
@@ -4584,8 +4593,7 @@ EventHandler::handleGetPlayerEmotesEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("emotes", slugsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
         log_->info("[EMOTE] Sent {} emotes for charId={}", slugsJson.size(), characterId);
     }
@@ -4646,6 +4654,7 @@ EventHandler::handleGetNPCAmbientSpeechEvent(const Event &event)
                 }
                 catch (...)
                 {
+                    markCatalogResponseFailed();
                     line["conditionGroup"] = nullptr;
                 }
             }
@@ -4669,13 +4678,13 @@ EventHandler::handleGetNPCAmbientSpeechEvent(const Event &event)
                                       .setHeader("eventType", "setNPCAmbientSpeech")
                                       .setBody("ambientSpeech", ambientArray)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        sendCatalogResponse(clientSocket, "success", response);
 
         log_->info("[AMBIENT] Sent ambient speech for {} NPCs to chunk server", ambientArray.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetNPCAmbientSpeechEvent error: " + std::string(ex.what()));
     }
 }
@@ -4695,58 +4704,63 @@ EventHandler::handleGetWorldObjectsEvent(const Event &event)
             txn, "get_world_objects", {});
         txn.commit();
 
-        nlohmann::json objectsArray = nlohmann::json::array();
+        // Streamed straight into the response buffer: no per-row DOM, no envelope copies
+        ResponseStream objectsStream;
+        JsonStreamWriter &rows = objectsStream.body();
+        rows.key("worldObjects").beginArray();
         for (const auto &row : result)
         {
-            nlohmann::json obj;
-            obj["id"] = row["id"].as<int>();
-            obj["slug"] = row["slug"].as<std::string>();
-            obj["nameKey"] = row["name_key"].as<std::string>();
-            obj["objectType"] = row["object_type"].as<std::string>();
-            obj["scope"] = row["scope"].as<std::string>();
-            obj["posX"] = row["pos_x"].as<float>();
-            obj["posY"] = row["pos_y"].as<float>();
-            obj["posZ"] = row["pos_z"].as<float>();
-            obj["rotZ"] = row["rot_z"].as<float>();
-            obj["zoneId"] = row["zone_id"].as<int>();
-            obj["dialogueId"] = row["dialogue_id"].as<int>();
-            obj["lootTableId"] = row["loot_table_id"].as<int>();
-            obj["requiredItemId"] = row["required_item_id"].as<int>();
-            obj["interactionRadius"] = row["interaction_radius"].as<float>();
-            obj["channelTimeSec"] = row["channel_time_sec"].as<int>();
-            obj["respawnSec"] = row["respawn_sec"].as<int>();
-            obj["isActiveByDefault"] = row["is_active_by_default"].as<bool>();
-            obj["minLevel"] = row["min_level"].as<int>();
-            obj["currentState"] = row["current_state"].as<std::string>();
+            rows.beginObject();
+            rows.field("id", row["id"].as<int>());
+            rows.field("slug", row["slug"].as<std::string>());
+            rows.field("nameKey", row["name_key"].as<std::string>());
+            rows.field("objectType", row["object_type"].as<std::string>());
+            rows.field("scope", row["scope"].as<std::string>());
+            rows.field("posX", row["pos_x"].as<float>());
+            rows.field("posY", row["pos_y"].as<float>());
+            rows.field("posZ", row["pos_z"].as<float>());
+            rows.field("rotZ", row["rot_z"].as<float>());
+            rows.field("zoneId", row["zone_id"].as<int>());
+            rows.field("dialogueId", row["dialogue_id"].as<int>());
+            rows.field("lootTableId", row["loot_table_id"].as<int>());
+            rows.field("requiredItemId", row["required_item_id"].as<int>());
+            rows.field("interactionRadius", row["interaction_radius"].as<float>());
+            rows.field("channelTimeSec", row["channel_time_sec"].as<int>());
+            rows.field("respawnSec", row["respawn_sec"].as<int>());
+            rows.field("isActiveByDefault", row["is_active_by_default"].as<bool>());
+            rows.field("minLevel", row["min_level"].as<int>());
+            rows.field("currentState", row["current_state"].as<std::string>());
 
             const std::string cgText = row["condition_group"].as<std::string>();
+            rows.key("conditionGroup");
             try
             {
-                obj["conditionGroup"] = nlohmann::json::parse(cgText);
+                rows.value(nlohmann::json::parse(cgText));
             }
             catch (...)
             {
-                obj["conditionGroup"] = nullptr;
+                markCatalogResponseFailed();
+                rows.value(nullptr);
             }
 
-            objectsArray.push_back(std::move(obj));
+            rows.endObject();
         }
+        rows.endArray();
 
-        ResponseBuilder builder;
-        nlohmann::json response = builder
-                                      .setHeader("message", "World objects list")
-                                      .setHeader("hash", "")
-                                      .setHeader("clientId", clientID)
-                                      .setHeader("eventType", "setWorldObjects")
-                                      .setBody("worldObjects", objectsArray)
-                                      .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        nlohmann::json header = ResponseBuilder()
+                                    .setHeader("message", "World objects list")
+                                    .setHeader("hash", "")
+                                    .setHeader("clientId", clientID)
+                                    .setHeader("eventType", "setWorldObjects")
+                                    .build()["header"];
+        sendCatalogResponse(clientSocket,
+            objectsStream.finish("success", header));
 
-        log_->info("[WIO] Sent {} world objects to chunk server", objectsArray.size());
+        log_->info("[WIO] Sent {} world objects to chunk server", result.size());
     }
     catch (const std::exception &ex)
     {
+        markCatalogResponseFailed();
         gameServices_.getLogger().logError("handleGetWorldObjectsEvent error: " + std::string(ex.what()));
     }
 }
@@ -4782,7 +4796,7 @@ EventHandler::handleSaveSkillCooldownEvent(const Event &event)
         gameServices_.getDatabase().executeQueryWithTransaction(txn, "upsert_skill_cooldown", params);
         txn.commit();
 
-        log_->debug("[SAVE_SKILL_COOLDOWN] char={} skill={} endsAt={}", characterId, skillSlug, cooldownEndsAtMs);
+        GS_LOG_DEBUG(log_, "[SAVE_SKILL_COOLDOWN] char={} skill={} endsAt={}", characterId, skillSlug, cooldownEndsAtMs);
     }
     catch (const std::exception &ex)
     {
@@ -4830,10 +4844,9 @@ EventHandler::handleGetPlayerSkillCooldownsEvent(const Event &event)
                                       .setBody("characterId", characterId)
                                       .setBody("cooldowns", cooldownsJson)
                                       .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", response));
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
 
-        log_->debug("[GET_SKILL_COOLDOWNS] char={} active={}", characterId, cooldownsJson.size());
+        GS_LOG_DEBUG(log_, "[GET_SKILL_COOLDOWNS] char={} active={}", characterId, cooldownsJson.size());
     }
     catch (const std::exception &ex)
     {
@@ -4842,7 +4855,8 @@ EventHandler::handleGetPlayerSkillCooldownsEvent(const Event &event)
 }
 
 // Analytics system (migration 058)
-// Inserts one row into game_analytics. Fire-and-forget — no reply to chunk server.
+// Queues one game_analytics row on the AnalyticsSink, which writes them in COPY batches.
+// Fire-and-forget — no reply to chunk server.
 // Body fields: analyticsType, characterId, sessionId, level, zoneId, payload (JSON object).
 void
 EventHandler::handleSaveAnalyticsEventEvent(const Event &event)
@@ -4870,24 +4884,9 @@ EventHandler::handleSaveAnalyticsEventEvent(const Event &event)
             return;
         }
 
-        auto sc = gameServices_.getDatabase().getConnectionLocked();
-        pqxx::work txn(sc.get());
+        gameServices_.getAnalyticsSink().record(eventType, charId, sessionId, level, zoneId, payload);
 
-        // Use exec_params with inline SQL — analytics INSERT does not need a reusable
-        // prepared statement because each call is already serialised through the event queue.
-        txn.exec_params(
-            "INSERT INTO game_analytics (event_type, character_id, session_id, level, zone_id, payload) "
-            "VALUES ($1, NULLIF($2, 0), $3, $4, $5, $6::jsonb)",
-            eventType,
-            charId,
-            sessionId,
-            level,
-            zoneId,
-            payload);
-
-        txn.commit();
-
-        log_->debug("[ANALYTICS] {} char={} session={} lvl={} zone={}", eventType, charId, sessionId, level, zoneId);
+        GS_LOG_DEBUG(log_, "[ANALYTICS] {} char={} session={} lvl={} zone={}", eventType, charId, sessionId, level, zoneId);
     }
     catch (const std::exception &ex)
     {
@@ -4911,12 +4910,15 @@ EventHandler::handleSavePlayTimeEvent(const Event &event)
         if (pt.characterId <= 0)
             return;
 
-        gameServices_.getCharacterManager().updatePlayTime(
-            gameServices_.getDatabase(),
+        auto &characterManager = gameServices_.getCharacterManager();
+        characterManager.markPlayTimeDirty(
             pt.characterId,
             pt.sessionPlayTimeSec,
             pt.lastSessionPlayTimeSec,
             pt.isDisconnect);
+        // Disconnect also clears is_online, which must not wait for the next flush
+        if (pt.isDisconnect)
+            characterManager.flushCharacter(gameServices_.getDatabase(), pt.characterId);
     }
     catch (const std::exception &ex)
     {
@@ -4962,3 +4964,56 @@ EventHandler::handleMarkCharactersOnlineEvent(const Event &event)
         gameServices_.getLogger().logError("handleMarkCharactersOnlineEvent error: " + std::string(ex.what()));
     }
 }
+
+void
+EventHandler::handleReloadStaticWorldDataEvent(const Event &event)
+{
+    std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = event.getClientSocket();
+
+    try
+    {
+        const int chunkId = gameServices_.getChunkManager().getChunkBySocket(clientSocket).id;
+        if (chunkId <= 0)
+        {
+            log_->warn("reloadStaticWorldData refused: request did not come from a registered chunk server");
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(staticWorldReloadMutex_);
+            const auto now = std::chrono::steady_clock::now();
+            if (lastStaticWorldReload_ && now - *lastStaticWorldReload_ < STATIC_WORLD_RELOAD_COOLDOWN)
+            {
+                const auto retryAfterSec = std::chrono::ceil<std::chrono::seconds>(
+                    *lastStaticWorldReload_ + STATIC_WORLD_RELOAD_COOLDOWN - now)
+                                               .count();
+                log_->warn("reloadStaticWorldData from chunk server {} refused: reloaded less than {}s ago",
+                    chunkId, STATIC_WORLD_RELOAD_COOLDOWN.count());
+                nlohmann::json response = ResponseBuilder()
+                                              .setHeader("message", "Static world data was reloaded recently")
+                                              .setHeader("hash", "")
+                                              .setHeader("eventType", "reloadStaticWorldData")
+                                              .setBody("retryAfterSec", retryAfterSec)
+                                              .build();
+                networkManager_.sendResponseMessage(clientSocket, "error", response);
+                return;
+            }
+            lastStaticWorldReload_ = now;
+        }
+
+        log_->info("Static world data reload requested by chunk server {}", chunkId);
+        const uint64_t bundleVersion = gameServices_.reloadStaticWorldData();
+
+        nlohmann::json response = ResponseBuilder()
+                                      .setHeader("message", "Static world data reloaded")
+                                      .setHeader("hash", "")
+                                      .setHeader("eventType", "reloadStaticWorldData")
+                                      .setBody("bundleVersion", bundleVersion)
+                                      .build();
+        networkManager_.sendResponseMessage(clientSocket, "success", response);
+    }
+    catch (const std::exception &ex)
+    {
+        gameServices_.getLogger().logError("handleReloadStaticWorldDataEvent error: " + std::string(ex.what()));
+    }
+}
@@ -1,66 +1,211 @@
 #include "events/EventQueue.hpp"
+#include <cstdint>
 
-void EventQueue::push(const Event &event)
+namespace
+{
+std::size_t
+roundUpToPowerOfTwo(std::size_t value)
 {
-    std::unique_lock<std::mutex> lock(mtx);
-    queue.push(event);
-    cv.notify_one();
+    std::size_t result = 2;
+    while (result < value)
+        result <<= 1;
+    return result;
 }
+} // namespace
 
-bool EventQueue::pop(Event &event)
+EventQueue::EventQueue(std::size_t capacity)
+    : mask_(roundUpToPowerOfTwo(capacity) - 1),
+      slots_(new Slot[mask_ + 1])
 {
-    std::unique_lock<std::mutex> lock(mtx);
-    cv.wait(lock, [this] { return !queue.empty(); });
+    for (std::size_t i = 0; i <= mask_; ++i)
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+}
 
-    event = std::move(queue.front());
-    queue.pop();
-    return true;
+bool EventQueue::tryPush(const Event &event)
+{
+    return tryPushImpl(event);
+}
+
+bool EventQueue::tryPush(Event &&event)
+{
+    return tryPushImpl(std::move(event));
 }
 
-void EventQueue::pushBatch(const std::vector<Event>& events) 
+template <class E>
+bool EventQueue::tryPushImpl(E &&event)
 {
-    std::unique_lock<std::mutex> lock(mtx);
-    for (const auto& event : events) {
-        queue.push(std::move(event));
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    for (;;)
+    {
+        slot = &slots_[pos & mask_];
+        std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            return false; // full
+        }
+        else
+        {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
     }
-    cv.notify_all();
+
+    slot->event = std::forward<E>(event);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
 }
 
-// bool EventQueue::popBatch(std::vector<Event>& events, int batchSize) 
-// {
-//     std::unique_lock<std::mutex> lock(mtx);
-//     cv.wait(lock, [this] { return !queue.empty(); }); // Ждем, пока в очереди появятся данные
+bool EventQueue::tryPop(Event &event)
+{
+    std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    for (;;)
+    {
+        slot = &slots_[pos & mask_];
+        std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0)
+        {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            return false; // empty
+        }
+        else
+        {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
 
-//     while (!queue.empty() && batchSize > 0) {
-//         events.push_back(std::move(queue.front())); 
-//         queue.pop();
-//         batchSize--;
-//     }
+    event = std::move(slot->event);
+    slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
 
-//     return !events.empty();
-// }
+void EventQueue::push(const Event &event)
+{
+    pushImpl(event);
+}
 
-bool EventQueue::popBatch(std::vector<Event>& events, int batchSize) 
+void EventQueue::push(Event &&event)
 {
-    std::unique_lock<std::mutex> lock(mtx);
-    cv.wait(lock, [this] { return !queue.empty(); });
+    pushImpl(std::move(event));
+}
 
-    int actualSize = std::min(batchSize, static_cast<int>(queue.size()));
-    events.reserve(events.size() + actualSize);
+template <class E>
+void EventQueue::pushImpl(E &&event)
+{
+    // tryPushImpl only consumes the event when it succeeds, so retrying after a failed move is safe
+    if (!tryPushImpl(std::forward<E>(event)))
+    {
+        // Full: apply back-pressure rather than drop the event
+        std::unique_lock<std::mutex> lock(mtx);
+        sleepingProducers_.fetch_add(1);
+        notFull_.wait(lock, [this, &event] { return tryPushImpl(std::forward<E>(event)); });
+        sleepingProducers_.fetch_sub(1);
+    }
+    updateHighWatermark();
+    notifyConsumers();
+}
 
-    while (!queue.empty() && batchSize > 0) {
-        events.push_back(std::move(queue.front())); 
-        queue.pop();
-        batchSize--;
+bool EventQueue::pop(Event &event)
+{
+    if (!tryPop(event))
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        sleepingConsumers_.fetch_add(1);
+        bool popped = false;
+        notEmpty_.wait(lock, [this, &event, &popped] { return (popped = tryPop(event)) || closed_.load(); });
+        sleepingConsumers_.fetch_sub(1);
+        if (!popped)
+            return false;
     }
+    notifyProducers();
+    return true;
+}
 
-    return !events.empty();
+void EventQueue::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        closed_ = true;
+    }
+    notEmpty_.notify_all();
 }
 
+void EventQueue::pushBatch(const std::vector<Event>& events)
+{
+    for (const auto &event : events)
+        push(event);
+}
+
+bool EventQueue::popBatch(std::vector<Event>& events, int batchSize)
+{
+    if (batchSize <= 0)
+        return false;
+
+    // Block for the first event only, then drain whatever is already there
+    Event event;
+    if (!pop(event))
+        return false;
+    events.push_back(std::move(event));
 
+    while (static_cast<int>(events.size()) < batchSize && tryPop(event))
+        events.push_back(std::move(event));
+
+    if (events.size() > 1)
+        notifyProducers();
+    return !events.empty();
+}
 
 bool EventQueue::empty()
 {
-    std::unique_lock<std::mutex> lock(mtx);
-    return queue.empty();
-}
\ No newline at end of file
+    return depth() == 0;
+}
+
+std::size_t EventQueue::depth() const
+{
+    std::size_t head = dequeuePos_.load(std::memory_order_relaxed);
+    std::size_t tail = enqueuePos_.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+}
+
+void EventQueue::updateHighWatermark()
+{
+    std::size_t current = depth();
+    std::size_t seen = highWatermark_.load(std::memory_order_relaxed);
+    while (current > seen &&
+           !highWatermark_.compare_exchange_weak(seen, current, std::memory_order_relaxed))
+    {
+    }
+}
+
+// The fence pairs with the seq_cst increment of the sleeper counter done under mtx:
+// either the sleeper sees the new event/slot in its wait predicate, or we see the sleeper here.
+void EventQueue::notifyConsumers()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepingConsumers_.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        notEmpty_.notify_one();
+    }
+}
+
+void EventQueue::notifyProducers()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepingProducers_.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        notFull_.notify_all();
+    }
+}
@@ -1,4 +1,5 @@
 #include "game_server/GameServer.hpp"
+#include <cstdint>
 #include <unordered_set>
 #include <spdlog/logger.h>
 
@@ -30,13 +31,12 @@ void GameServer::mainEventLoopGS()
     try
     {
         log_->info("Starting Game Server Event Loop...");
-        while (running_)
+        // popBatch() returns false once stop() has closed the queue and it is drained
+        std::vector<Event> eventsBatch;
+        while (eventQueueGameServer_.popBatch(eventsBatch, BATCH_SIZE))
         {
-            std::vector<Event> eventsBatch;
-            if (eventQueueGameServer_.popBatch(eventsBatch, BATCH_SIZE))
-            {
-                processBatch(eventsBatch);
-            }
+            processBatch(std::move(eventsBatch));
+            eventsBatch.clear();
         }
     }
     catch (const std::exception &e)
@@ -57,13 +57,12 @@ void GameServer::mainEventLoopCH()
     try
     {
         log_->info("Starting Chunk Server Event Loop...");
-        while (running_)
+        // popBatch() returns false once stop() has closed the queue and it is drained
+        std::vector<Event> eventsBatch;
+        while (eventQueueChunkServer_.popBatch(eventsBatch, BATCH_SIZE))
         {
-            std::vector<Event> eventsBatch;
-            if (eventQueueChunkServer_.popBatch(eventsBatch, BATCH_SIZE))
-            {
-                processBatch(eventsBatch);
-            }
+            processBatch(std::move(eventsBatch));
+            eventsBatch.clear();
         }
     }
     catch (const std::exception &e)
@@ -80,13 +79,12 @@ void GameServer::mainEventLoopPing()
 
     try
     {
-        while (running_)
+        // popBatch() returns false once stop() has closed the queue and it is drained
+        std::vector<Event> pingEvents;
+        while (eventQueueGameServerPing_.popBatch(pingEvents, BATCH_SIZE))
         {
-            std::vector<Event> pingEvents;
-            if (eventQueueGameServerPing_.popBatch(pingEvents, BATCH_SIZE))
-            {
-                processPingBatch(pingEvents);
-            }
+            processPingBatch(std::move(pingEvents));
+            pingEvents.clear();
         }
     }
     catch (const std::exception &e)
@@ -95,14 +93,19 @@ void GameServer::mainEventLoopPing()
     }
 }
 
-void GameServer::processPingBatch(const std::vector<Event>& pingEvents)
+void GameServer::processPingBatch(std::vector<Event> pingEvents)
 {
-    for (const auto& event : pingEvents)
+    // Pings carry no state to order against, so they skip the lanes
+    auto batch = std::make_shared<const std::vector<Event>>(std::move(pingEvents));
+
+    std::vector<PoolTask> tasks;
+    tasks.reserve(batch->size());
+    for (size_t i = 0; i < batch->size(); ++i)
     {
-        threadPool_.enqueueTask([this, event] {
+        tasks.emplace_back([this, batch, i] {
             try
             {
-                eventHandler_.dispatchEvent(event);
+                eventHandler_.dispatchEvent((*batch)[i]);
             }
             catch (const std::exception &e)
             {
@@ -110,65 +113,100 @@ void GameServer::processPingBatch(const std::vector<Event>& pingEvents)
             }
         });
     }
+    threadPool_.enqueueBatch(std::move(tasks));
 
     eventCondition.notify_all();
 }
 
-void GameServer::processBatch(const std::vector<Event>& eventsBatch)
+void GameServer::processBatch(std::vector<Event> eventsBatch)
 {
-    std::vector<Event> priorityEvents;
-    std::vector<Event> normalEvents;
-
-    // Separate ping events from other events
-    for (const auto& event : eventsBatch)
-    {
-        // if (event.PING_CLIENT == Event::PING_CLIENT)
-        //     priorityEvents.push_back(event);
-        // else
-            normalEvents.push_back(event);
-    }
-
-    // Process priority ping events first
-    for (const auto& event : priorityEvents)
+    // The batch is moved once into shared immutable storage; each task only captures
+    // the pointer and an index (fits PoolTask's inline buffer). Tasks are keyed so that
+    // events for the same character run in arrival order while unrelated ones run in
+    // parallel, and all newly runnable lanes reach the pool in one submission.
+    auto batch = std::make_shared<const std::vector<Event>>(std::move(eventsBatch));
+
+    std::vector<std::pair<ShardedExecutor::Key, PoolTask>> tasks;
+    tasks.reserve(batch->size());
+    for (size_t i = 0; i < batch->size(); ++i)
     {
-        // Create a deep copy of the event to ensure its data remains valid
-        // when processed asynchronously in the thread pool
-        Event eventCopy = event;
-        threadPool_.enqueueTask([this, eventCopy] {
+        tasks.emplace_back(laneKeyFor((*batch)[i]), [this, batch, i] {
             try
             {
-                eventHandler_.dispatchEvent(eventCopy);
+                eventHandler_.dispatchEvent((*batch)[i]);
             }
             catch (const std::exception &e)
             {
-                gameServices_.getLogger().logError("Error processing priority dispatchEvent: " + std::string(e.what()));
+                gameServices_.getLogger().logError("Error in normal dispatchEvent: " + std::string(e.what()));
             }
         });
     }
+    laneExecutor_.postBatch(std::move(tasks));
+
+    eventCondition.notify_all();
+}
+
+ShardedExecutor::Key GameServer::laneKeyFor(const Event &event)
+{
+    // Character/client scoped events carry the id directly
+    if (event.getClientID() != 0)
+        return static_cast<ShardedExecutor::Key>(event.getClientID());
 
-    // Process normal events
-    for (const auto& event : normalEvents)
+    switch (event.getType())
     {
-        // Create a deep copy of the event to ensure its data remains valid
-        // when processed asynchronously in the thread pool
-        Event eventCopy = event;
-        threadPool_.enqueueTask([this, eventCopy] {
-            try
-            {
-                eventHandler_.dispatchEvent(eventCopy);
-            }
-            catch (const std::exception &e)
+    // Single-character saves arrive as the JSON body with a characterId field
+    case Event::SAVE_INVENTORY_CHANGE:
+    case Event::SAVE_EQUIPMENT_CHANGE:
+    case Event::SAVE_EXPERIENCE_DEBT:
+    case Event::SAVE_ACTIVE_EFFECT:
+    case Event::SAVE_DURABILITY_CHANGE:
+    case Event::SAVE_ITEM_KILL_COUNT:
+    case Event::SAVE_PITY_COUNTER:
+    case Event::SAVE_BESTIARY_KILL:
+    case Event::SAVE_REPUTATION:
+    case Event::SAVE_MASTERY:
+    case Event::SAVE_LEARNED_SKILL:
+    case Event::SAVE_SKILL_BAR_SLOT:
+    case Event::SAVE_PLAYER_TITLE:
+    case Event::SAVE_SKILL_COOLDOWN:
+    case Event::UPDATE_PLAYER_QUEST_PROGRESS:
+    case Event::UPDATE_PLAYER_FLAG:
+    {
+        const auto &data = event.getData();
+        if (const auto *json = std::get_if<nlohmann::json>(&data))
+        {
+            const nlohmann::json &body = json->contains("body") ? (*json)["body"] : *json;
+            auto it = body.find("characterId");
+            if (it != body.end() && it->is_number_integer() && it->get<int>() != 0)
+                return static_cast<ShardedExecutor::Key>(it->get<int>());
+        }
+        break;
+    }
+    // Item moves run in the lane of the character losing the item, behind its pending
+    // inventory saves; pickups from the ground have no sender and use the receiver
+    case Event::TRANSFER_INVENTORY_ITEM:
+    case Event::NULLIFY_ITEM_OWNER:
+    {
+        const auto &data = event.getData();
+        if (const auto *json = std::get_if<nlohmann::json>(&data))
+        {
+            for (const char *field : {"fromCharId", "toCharId"})
             {
-                gameServices_.getLogger().logError("Error in normal dispatchEvent: " + std::string(e.what()));
+                auto it = json->find(field);
+                if (it != json->end() && it->is_number_integer() && it->get<int>() > 0)
+                    return static_cast<ShardedExecutor::Key>(it->get<int>());
             }
-        });
+        }
+        break;
+    }
+    default:
+        break;
     }
 
-    eventCondition.notify_all();
+    // Batch saves, catalog loads and chunk-server lifecycle events stay ordered per chunk socket
+    return static_cast<ShardedExecutor::Key>(reinterpret_cast<std::uintptr_t>(event.getClientSocket().get()));
 }
 
-
-
 void GameServer::startMainEventLoop()
 {
     if (event_game_server_thread_.joinable() || event_chunk_server_thread_.joinable())
@@ -184,16 +222,15 @@ void GameServer::startMainEventLoop()
 
 void GameServer::stop()
 {
-    running_ = false;
-    scheduler_.stop();
-    eventCondition.notify_all();
-}
+    if (!running_.exchange(false))
+        return;
 
-GameServer::~GameServer()
-{
-    log_->info("Shutting down Game Server...");
-    
-    stop();  
+    // The loops finish what is already queued, then the lanes and the pool run dry;
+    // stop the NetworkManager first so nothing new arrives meanwhile
+    eventQueueGameServer_.close();
+    eventQueueChunkServer_.close();
+    eventQueueGameServerPing_.close();
+    eventCondition.notify_all();
 
     if (event_game_server_thread_.joinable())
         event_game_server_thread_.join();
@@ -203,4 +240,14 @@ GameServer::~GameServer()
 
     if (event_ping_thread_.joinable())
         event_ping_thread_.join();
+
+    threadPool_.waitIdle();
+    scheduler_.stop();
+}
+
+GameServer::~GameServer()
+{
+    log_->info("Shutting down Game Server...");
+
+    stop();
 }
@@ -5,39 +5,35 @@ MessageHandler::MessageHandler(JSONParser &jsonParser) : jsonParser_(jsonParser)
 std::tuple<std::string, ClientDataStruct, ChunkInfoStruct, CharacterDataStruct, PositionStruct, MessageStruct>
 MessageHandler::parseMessage(const std::string &message)
 {
-    const char *data = message.data();
-    size_t messageLength = message.size();
+    const nlohmann::json document = nlohmann::json::parse(message);
 
-    std::string eventType = jsonParser_.parseEventType(data, messageLength);
-    ClientDataStruct clientData = jsonParser_.parseClientData(data, messageLength);
-    ChunkInfoStruct chunkData = jsonParser_.parseChunkServerHandshakeData(data, messageLength);
+    std::string eventType = jsonParser_.parseEventType(document);
+    ClientDataStruct clientData = jsonParser_.parseClientData(document);
+    ChunkInfoStruct chunkData = jsonParser_.parseChunkServerHandshakeData(document);
 
-    CharacterDataStruct characterData = jsonParser_.parseCharacterData(data, messageLength);
-    PositionStruct positionData = jsonParser_.parsePositionData(data, messageLength);
-    MessageStruct messageStruct = jsonParser_.parseMessage(data, messageLength);
+    CharacterDataStruct characterData = jsonParser_.parseCharacterData(document);
+    PositionStruct positionData = jsonParser_.parsePositionData(document);
+    MessageStruct messageStruct = jsonParser_.parseMessage(document);
 
     return {eventType, clientData, chunkData, characterData, positionData, messageStruct};
 }
 
-std::tuple<std::string, ClientDataStruct, ChunkInfoStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct>
-MessageHandler::parseMessageWithTimestamps(const std::string &message)
+std::tuple<std::string, ClientDataStruct, ChunkInfoStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct, std::shared_ptr<const nlohmann::json>>
+MessageHandler::parseMessageWithTimestamps(std::string_view message, WireFormat format)
 {
-    const char *data = message.data();
-    size_t messageLength = message.size();
+    // Single parse per packet — the document is shared with the dispatcher afterwards
+    auto document = std::make_shared<const nlohmann::json>(WireCodec::decode(message, format));
 
-    std::string eventType = jsonParser_.parseEventType(data, messageLength);
-    ClientDataStruct clientData = jsonParser_.parseClientData(data, messageLength);
-    ChunkInfoStruct chunkData = jsonParser_.parseChunkServerHandshakeData(data, messageLength);
+    std::string eventType = jsonParser_.parseEventType(*document);
+    ClientDataStruct clientData = jsonParser_.parseClientData(*document);
+    ChunkInfoStruct chunkData = jsonParser_.parseChunkServerHandshakeData(*document);
 
-    CharacterDataStruct characterData = jsonParser_.parseCharacterData(data, messageLength);
-    PositionStruct positionData = jsonParser_.parsePositionData(data, messageLength);
-    MessageStruct messageStruct = jsonParser_.parseMessage(data, messageLength);
+    CharacterDataStruct characterData = jsonParser_.parseCharacterData(*document);
+    PositionStruct positionData = jsonParser_.parsePositionData(*document);
+    MessageStruct messageStruct = jsonParser_.parseMessage(*document);
 
-    // Parse timestamps from message
-    std::array<char, 1024> messageBuffer{};
-    size_t copySize = std::min(messageLength, messageBuffer.size());
-    std::memcpy(messageBuffer.data(), data, copySize);
-    TimestampStruct timestamps = TimestampUtils::parseTimestampsFromBuffer(messageBuffer, copySize);
+    // Timestamps come from the same header — no buffer copy or second parse
+    TimestampStruct timestamps = TimestampUtils::parseTimestampsFromHeader(*document);
 
-    return {eventType, clientData, chunkData, characterData, positionData, messageStruct, timestamps};
+    return {eventType, clientData, chunkData, characterData, positionData, messageStruct, timestamps, std::move(document)};
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "utils/Logger.hpp"
 #include "utils/Scheduler.hpp"
 #include "utils/TimeConverter.hpp"
+#include <algorithm>
 #include <atomic>
 #include <csignal>
 #include <iostream>
@@ -14,6 +15,12 @@
 
 std::atomic<bool> running(true);
 
+constexpr int CHARACTER_FLUSH_TASK_ID = 1;
+constexpr int EXPIRED_EFFECTS_CLEANUP_TASK_ID = 2;
+constexpr int INVENTORY_FLUSH_TASK_ID = 3;
+
+constexpr std::chrono::seconds EXPIRED_EFFECTS_CLEANUP_INTERVAL(60);
+
 void
 signalHandler(int signal)
 {
@@ -40,20 +47,26 @@ main()
         EventQueue eventQueueGameServer;
         EventQueue eventQueueGameServerPing;
 
-        // Initialize Scheduler
-        Scheduler scheduler;
-
         // Initialize Database
         Database database(configs, logger);
 
-        // Initialize CharacterManager
-        CharacterManager characterManager(logger);
+        // Initialize GameServices
+        GameServices gameServices(database, logger);
 
         // Reset online status for all characters (crash recovery)
-        characterManager.resetAllOnline(database);
+        gameServices.getCharacterManager().resetAllOnline(database);
 
-        // Initialize GameServices
-        GameServices gameServices(database, logger);
+        // Buffered COPY ingestion of game_analytics rows
+        const auto &gsConfig = std::get<1>(configs);
+        AnalyticsSinkSettings analyticsSettings;
+        analyticsSettings.flushRows = gsConfig.analytics_flush_rows;
+        analyticsSettings.flushInterval = std::chrono::milliseconds(gsConfig.analytics_flush_interval_ms);
+        analyticsSettings.maxBufferedBytes = gsConfig.analytics_max_buffer_bytes;
+        analyticsSettings.spillPath = gsConfig.analytics_spill_path;
+        gameServices.getAnalyticsSink().start(analyticsSettings);
+
+        // Initialize Scheduler (after GameServices: its tasks use the services and it is destroyed first)
+        Scheduler scheduler(logger);
 
         // Initialize NetworkManager
         NetworkManager networkManager(eventQueueGameServer, eventQueueGameServerPing, configs, logger);
@@ -76,6 +89,39 @@ main()
         // Start Game Server main event loop in a separate thread
         gameServer.startMainEventLoop();
 
+        // Write-behind flush of character state (position, HP/Mana, exp, play time)
+        const std::chrono::seconds characterFlushInterval(std::max(1, gsConfig.character_flush_interval_sec));
+        scheduler.scheduleTask(Task(
+            [&gameServices]()
+            { gameServices.getCharacterManager().flushDirtyCharacters(gameServices.getDatabase()); },
+            characterFlushInterval,
+            std::chrono::steady_clock::now() + characterFlushInterval,
+            CHARACTER_FLUSH_TASK_ID));
+
+        // Write-behind flush of inventory items (quantity, durability, kill count)
+        const std::chrono::seconds inventoryFlushInterval(std::max(1, gsConfig.inventory_flush_interval_sec));
+        scheduler.scheduleTask(Task(
+            [&gameServices]()
+            { gameServices.getInventoryWriteBehind().flushDirtyItems(gameServices.getDatabase()); },
+            inventoryFlushInterval,
+            std::chrono::steady_clock::now() + inventoryFlushInterval,
+            INVENTORY_FLUSH_TASK_ID));
+
+        // Prune expired player_active_effect rows (reads already filter them out).
+        // Jittered so the table-wide DELETE does not line up with the flush.
+        scheduler.scheduleTask(Task(
+            [&database]()
+            {
+                auto dbConn = database.getConnectionLocked();
+                pqxx::work txn(dbConn.get());
+                database.executeQueryWithTransaction(txn, "cleanup_expired_active_effects", {});
+                txn.commit();
+            },
+            EXPIRED_EFFECTS_CLEANUP_INTERVAL,
+            std::chrono::steady_clock::now() + EXPIRED_EFFECTS_CLEANUP_INTERVAL,
+            EXPIRED_EFFECTS_CLEANUP_TASK_ID,
+            std::chrono::seconds(5)));
+
         // Start Scheduler loop in a separate thread
         scheduler.start();
 
@@ -87,6 +133,18 @@ main()
 
         logger.info("Shutting down gracefully...");
 
+        // Nothing may mark state dirty after the final flushes: stop taking connections and
+        // events, let the game server drain its queues and lanes, then stop the periodic
+        // tasks (waiting for a running flush)
+        networkManager.stop();
+        gameServer.stop();
+        scheduler.stop();
+        const int flushed = gameServices.getCharacterManager().flushDirtyCharacters(database);
+        logger.info("Flushed pending state for " + std::to_string(flushed) + " character(s)");
+        const int flushedItems = gameServices.getInventoryWriteBehind().flushDirtyItems(database);
+        logger.info("Flushed pending state for " + std::to_string(flushedItems) + " inventory item(s)");
+        gameServices.getAnalyticsSink().stop();
+
         return 0;
     }
     catch (const std::exception &e)
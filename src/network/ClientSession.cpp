@@ -3,6 +3,9 @@
 #include "events/EventDispatcher.hpp"
 #include "game_server/GameServer.hpp"
 #include "handlers/MessageHandler.hpp"
+#include "utils/LogMacros.hpp"
+#include <algorithm>
+#include <cstring>
 #include <spdlog/logger.h>
 
 ClientSession::ClientSession(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
@@ -35,30 +38,60 @@ ClientSession::setDisconnectCallback(std::function<void(std::shared_ptr<ClientSe
     disconnectCallback_ = std::move(callback);
 }
 
+void
+ClientSession::setWireFormatCallback(std::function<void(WireFormat)> callback)
+{
+    wireFormatCallback_ = std::move(callback);
+}
+
+void
+ClientSession::pauseReading()
+{
+    std::lock_guard<std::mutex> lock(readStateMutex_);
+    readPaused_ = true;
+}
+
+void
+ClientSession::resumeReading()
+{
+    {
+        std::lock_guard<std::mutex> lock(readStateMutex_);
+        readPaused_ = false;
+        if (!readParked_)
+            return; // the outstanding read will simply continue
+        readParked_ = false;
+    }
+    // Read even if the socket was closed meanwhile: the failing read runs the disconnect path
+    doRead();
+}
+
 void
 ClientSession::doRead()
 {
+    prepareReadSpace();
+    const std::size_t offered = readBuffer_.size() - readEnd_;
+
     auto self(shared_from_this());
-    socket_->async_read_some(boost::asio::buffer(dataBuffer_),
-        [this, self](boost::system::error_code ec, std::size_t bytes_transferred)
+    socket_->async_read_some(boost::asio::buffer(readBuffer_.data() + readEnd_, offered),
+        [this, self, offered](boost::system::error_code ec, std::size_t bytes_transferred)
         {
             if (!ec)
             {
-                // Append new data to our session-specific buffer.
-                accumulatedData_.append(dataBuffer_.data(), bytes_transferred);
-
-                // log the received data
-                log_->info("DEBUG Received data from client: " + accumulatedData_);
+                readEnd_ += bytes_transferred;
+                adaptReadSize(bytes_transferred, offered);
 
-                std::string delimiter = "\n";
-                size_t pos;
-                // Process all complete messages found.
-                while ((pos = accumulatedData_.find(delimiter)) != std::string::npos)
+                if (!processFrames())
                 {
-                    std::string message = accumulatedData_.substr(0, pos);
-                    log_->info("Received data from client: " + message);
-                    processMessage(message);
-                    accumulatedData_.erase(0, pos + delimiter.size());
+                    handleClientDisconnect();
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(readStateMutex_);
+                    if (readPaused_)
+                    {
+                        readParked_ = true;
+                        return;
+                    }
                 }
                 doRead();
             }
@@ -76,12 +109,114 @@ ClientSession::doRead()
 }
 
 void
-ClientSession::processMessage(const std::string &message)
+ClientSession::prepareReadSpace()
+{
+    if (readStart_ == readEnd_)
+    {
+        // Drained: rewind for free, and give back memory a large snapshot left behind
+        readStart_ = readEnd_ = scanPos_ = 0;
+        if (readBuffer_.size() > 4 * MAX_READ_SIZE)
+        {
+            readBuffer_.resize(readSize_);
+            readBuffer_.shrink_to_fit();
+        }
+    }
+
+    if (readBuffer_.size() - readEnd_ >= readSize_)
+        return;
+
+    // Move the partial frame to the front once per read, not once per message
+    if (readStart_ > 0)
+    {
+        const std::size_t pending = readEnd_ - readStart_;
+        std::memmove(readBuffer_.data(), readBuffer_.data() + readStart_, pending);
+        scanPos_ -= readStart_;
+        readStart_ = 0;
+        readEnd_ = pending;
+    }
+
+    if (readBuffer_.size() - readEnd_ < readSize_)
+        readBuffer_.resize(std::max(readEnd_ + readSize_, readBuffer_.size() * 2));
+}
+
+bool
+ClientSession::processFrames()
+{
+    for (;;)
+    {
+        const char *base = readBuffer_.data();
+        std::string_view message;
+
+        // The format is re-checked per frame: a handshake may switch it mid-buffer
+        if (readFormat_ == WireFormat::Json)
+        {
+            if (scanPos_ >= readEnd_)
+                break;
+            const void *found = std::memchr(base + scanPos_, '\n', readEnd_ - scanPos_);
+            if (!found)
+            {
+                scanPos_ = readEnd_;
+                break;
+            }
+
+            const std::size_t delimiter = static_cast<const char *>(found) - base;
+            message = std::string_view(base + readStart_, delimiter - readStart_);
+            readStart_ = scanPos_ = delimiter + 1;
+        }
+        else
+        {
+            const std::size_t available = readEnd_ - readStart_;
+            if (available < WireCodec::LENGTH_PREFIX_SIZE)
+                break;
+            const std::size_t length = WireCodec::readLengthPrefix(base + readStart_);
+            if (length > MAX_FRAME_SIZE)
+            {
+                log_->error("Dropping client: frame of " + std::to_string(length) + " bytes exceeds " +
+                            std::to_string(MAX_FRAME_SIZE));
+                return false;
+            }
+            if (available - WireCodec::LENGTH_PREFIX_SIZE < length)
+                break;
+
+            message = std::string_view(base + readStart_ + WireCodec::LENGTH_PREFIX_SIZE, length);
+            readStart_ = scanPos_ = readStart_ + WireCodec::LENGTH_PREFIX_SIZE + length;
+        }
+        processMessage(message);
+    }
+
+    if (readEnd_ - readStart_ > MAX_FRAME_SIZE + WireCodec::LENGTH_PREFIX_SIZE)
+    {
+        log_->error("Dropping client: unterminated frame exceeds " + std::to_string(MAX_FRAME_SIZE) + " bytes");
+        return false;
+    }
+    return true;
+}
+
+// Double the window while reads fill it completely (a burst is in flight), halve it
+// when they use less than a quarter, so idle clients do not pin large buffers.
+void
+ClientSession::adaptReadSize(std::size_t bytesTransferred, std::size_t offered)
+{
+    if (bytesTransferred == offered)
+        readSize_ = std::min(readSize_ * 2, MAX_READ_SIZE);
+    else if (bytesTransferred < readSize_ / 4)
+        readSize_ = std::max(readSize_ / 2, MIN_READ_SIZE);
+}
+
+void
+ClientSession::processMessage(std::string_view message)
 {
+    GS_LOG_DEBUG(log_, "Received message from client ({} bytes)", message.size());
+
     try
     {
         // Parse message using MessageHandler with timestamps for all request-response packets
-        auto [eventType, clientData, chunkData, characterData, positionData, messageStruct, timestamps] = messageHandler_.parseMessageWithTimestamps(message);
+        auto [eventType, clientData, chunkData, characterData, positionData, messageStruct, timestamps, document] = messageHandler_.parseMessageWithTimestamps(message, readFormat_);
+
+        // Switch encodings before anything is dispatched, so every reply to the handshake
+        // and every following frame already uses the negotiated format
+        if (eventType == "chunkServerConnection")
+            negotiateWireFormat(*document);
 
         // Set additional client data
         clientData.socket = socket_;
@@ -94,6 +229,7 @@ ClientSession::processMessage(const std::string &message)
             .positionData = positionData,
             .messageStruct = messageStruct,
             .rawMessage = message,
+            .document = std::move(document),
         };
 
         // For ping events, use special handling with timestamps
@@ -115,6 +251,31 @@ ClientSession::processMessage(const std::string &message)
     }
 }
 
+void
+ClientSession::negotiateWireFormat(const nlohmann::json &handshake)
+{
+    auto header = handshake.find("header");
+    if (header == handshake.end() || !header->is_object())
+        return;
+    auto requested = header->find("wireFormat");
+    if (requested == header->end() || !requested->is_string())
+        return;
+
+    auto format = WireCodec::fromName(requested->get<std::string>());
+    if (!format)
+    {
+        log_->warn("Unsupported wire format requested: " + requested->get<std::string>() + ", staying on json");
+        return;
+    }
+    if (*format == readFormat_)
+        return;
+
+    readFormat_ = *format;
+    if (wireFormatCallback_)
+        wireFormatCallback_(*format);
+    log_->info(std::string("Wire format negotiated: ") + WireCodec::name(*format));
+}
+
 void
 ClientSession::handleClientDisconnect()
 {
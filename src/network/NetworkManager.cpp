@@ -2,9 +2,25 @@
 
 #include "events/EventDispatcher.hpp"
 #include "handlers/MessageHandler.hpp"
+#include "utils/JsonStreamWriter.hpp"
+#include "utils/LogMacros.hpp"
 #include "utils/TimestampUtils.hpp"
+#include <algorithm>
 #include <spdlog/logger.h>
 
+namespace
+{
+std::string
+describePeer(const boost::asio::ip::tcp::socket &socket)
+{
+    boost::system::error_code ec;
+    auto endpoint = socket.remote_endpoint(ec);
+    if (ec)
+        return "<disconnected>";
+    return endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
+}
+} // namespace
+
 NetworkManager::NetworkManager(
     EventQueue &eventQueue,
     EventQueue &eventQueuePing,
@@ -18,6 +34,19 @@ NetworkManager::NetworkManager(
       eventQueuePing_(eventQueuePing)
 {
     log_ = logger.getSystem("network");
+    // A single message larger than the cap is still sent, just on its own
+    maxWriteBatchBytes_ = std::max<size_t>(1, std::get<1>(configs).max_write_batch_bytes);
+    writeHighWatermark_ = std::max<size_t>(1, std::get<1>(configs).write_high_watermark);
+    writeLowWatermark_ = std::min(std::get<1>(configs).write_low_watermark, writeHighWatermark_);
+    writeHardLimit_ = std::max(std::get<1>(configs).write_hard_limit, writeHighWatermark_);
+
+    // Default slow-consumer policy: stop reading new requests from the peer, and
+    // drop it if its backlog keeps growing anyway
+    slowConsumerPolicy_ = [](const WriteQueueStatus &status)
+    {
+        return status.queuedBytes > status.hardLimit ? SlowConsumerAction::Disconnect
+                                                     : SlowConsumerAction::PauseReading;
+    };
     boost::system::error_code ec;
 
     short customPort = std::get<1>(configs).port;
@@ -70,6 +99,7 @@ NetworkManager::startAccept()
             // Pass the shared pointer to the ClientSession
             auto session = std::make_shared<ClientSession>(clientSocket, gameServer_, logger_, eventQueue_, eventQueuePing_, *eventDispatcher_, *messageHandler_);
             session->setDisconnectCallback([this](std::shared_ptr<ClientSession> s) { removeActiveSession(s); });
+            session->setWireFormatCallback([this, sock = clientSocket.get()](WireFormat format) { setWireFormat(sock, format); });
             addActiveSession(session);
             session->start();
         }
@@ -91,10 +121,11 @@ NetworkManager::startIOEventLoop()
     }
 }
 
-NetworkManager::~NetworkManager()
+void
+NetworkManager::stop()
 {
-    log_->warn("Network Manager destructor is called...");
-    acceptor_.close();
+    boost::system::error_code ec;
+    acceptor_.close(ec);
     io_context_.stop();
     for (auto &thread : threadPool_)
     {
@@ -103,8 +134,109 @@ NetworkManager::~NetworkManager()
     }
 }
 
+NetworkManager::~NetworkManager()
+{
+    log_->warn("Network Manager destructor is called...");
+    stop();
+}
+
+void
+NetworkManager::sendResponse(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+    std::string responseString,
+    std::string coalesceKey)
+{
+    if (!clientSocket || !clientSocket->is_open())
+    {
+        log_->error("Attempted write on closed or invalid socket.");
+        return;
+    }
+
+    auto state = getOrCreateSocketState(clientSocket.get());
+
+    // Already JSON text; peers that negotiated a binary format get it re-encoded
+    std::shared_ptr<const std::string> frame;
+    const WireFormat format = state->wireFormat.load(std::memory_order_acquire);
+    if (format == WireFormat::Json)
+    {
+        frame = std::make_shared<const std::string>(std::move(responseString));
+    }
+    else
+    {
+        try
+        {
+            frame = std::make_shared<const std::string>(WireCodec::transcodeFrame(responseString, format));
+        }
+        catch (const nlohmann::json::exception &e)
+        {
+            log_->error(std::string("Dropping response that could not be re-encoded: ") + e.what());
+            return;
+        }
+    }
+
+    postFrame(std::move(clientSocket), std::move(state), std::move(frame), std::move(coalesceKey));
+}
+
+void
+NetworkManager::sendResponseMessage(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+    const std::string &status,
+    const nlohmann::json &message,
+    std::string coalesceKey)
+{
+    sendEnvelope(std::move(clientSocket), status, message, nullptr, std::move(coalesceKey));
+}
+
+void
+NetworkManager::sendResponseMessage(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+    const std::string &status,
+    const nlohmann::json &message,
+    const TimestampStruct &timestamps)
+{
+    sendEnvelope(std::move(clientSocket), status, message, &timestamps, {});
+}
+
+void
+NetworkManager::sendEnvelope(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+    const std::string &status,
+    const nlohmann::json &message,
+    const TimestampStruct *timestamps,
+    std::string coalesceKey)
+{
+    if (!clientSocket || !clientSocket->is_open())
+    {
+        log_->error("Attempted write on closed or invalid socket.");
+        return;
+    }
+
+    auto state = getOrCreateSocketState(clientSocket.get());
+    const WireFormat format = state->wireFormat.load(std::memory_order_acquire);
+    std::string frame;
+    if (format == WireFormat::Json)
+    {
+        frame = buildEnvelope(status, message, timestamps);
+    }
+    else
+    {
+        static const nlohmann::json noBody;
+        auto body = message.find("body");
+        auto header = message.find("header");
+        try
+        {
+            frame = WireCodec::encodeFrame(body != message.end() ? *body : noBody,
+                makeEnvelopeHeader(status, header != message.end() ? &*header : nullptr, timestamps),
+                format);
+        }
+        catch (const nlohmann::json::exception &e)
+        {
+            log_->error(std::string("Dropping response that could not be encoded: ") + e.what());
+            return;
+        }
+    }
+
+    postFrame(std::move(clientSocket), std::move(state), std::make_shared<const std::string>(std::move(frame)), std::move(coalesceKey));
+}
+
 void
-NetworkManager::sendResponse(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, const std::string &responseString)
+NetworkManager::sendFrame(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, std::string frame)
 {
     if (!clientSocket || !clientSocket->is_open())
     {
@@ -112,17 +244,187 @@ NetworkManager::sendResponse(std::shared_ptr<boost::asio::ip::tcp::socket> clien
         return;
     }
 
+    auto state = getOrCreateSocketState(clientSocket.get());
+    postFrame(std::move(clientSocket), std::move(state), std::make_shared<const std::string>(std::move(frame)), {});
+}
+
+void
+NetworkManager::postFrame(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+    std::shared_ptr<SocketWriteState> state,
+    std::shared_ptr<const std::string> frame,
+    std::string coalesceKey)
+{
     // MEDIUM-8 fix: Serialise concurrent writes per socket via a per-socket strand +
     // write queue. Multiple EventHandler threads can call sendResponse concurrently
     // for the same chunk-server connection; without serialisation that causes UB.
-    auto dataPtr = std::make_shared<const std::string>(responseString);
-    auto state = getOrCreateSocketState(clientSocket.get());
-
-    boost::asio::post(state->strand, [this, clientSocket, dataPtr, state]() mutable
+    auto &strand = state->strand;
+    boost::asio::post(strand, [this, socket = std::move(socket), frame = std::move(frame), state = std::move(state), coalesceKey = std::move(coalesceKey)]() mutable
         {
-            state->writeQueue.push(dataPtr);
+            enqueueWrite(*state, std::move(frame), std::move(coalesceKey));
+            if (state->queuedBytes > writeHighWatermark_)
+            {
+                applyBackPressure(socket, *state);
+                if (!socket->is_open())
+                    return;
+            }
             if (!state->writePending)
-                doNextWrite(std::move(clientSocket), std::move(state)); });
+                doNextWrite(std::move(socket), std::move(state)); });
+}
+
+void
+NetworkManager::setWireFormat(boost::asio::ip::tcp::socket *socket, WireFormat format)
+{
+    getOrCreateSocketState(socket)->wireFormat.store(format, std::memory_order_release);
+}
+
+WireFormat
+NetworkManager::getWireFormat(const std::shared_ptr<boost::asio::ip::tcp::socket> &socket)
+{
+    return getOrCreateSocketState(socket.get())->wireFormat.load(std::memory_order_acquire);
+}
+
+void
+NetworkManager::setSlowConsumerPolicy(SlowConsumerPolicy policy)
+{
+    slowConsumerPolicy_ = std::move(policy);
+}
+
+void
+NetworkManager::enqueueWrite(SocketWriteState &state, std::shared_ptr<const std::string> data, std::string coalesceKey)
+{
+    const size_t size = data->size();
+
+    if (!coalesceKey.empty())
+    {
+        auto it = state.coalesceIndex.find(coalesceKey);
+        if (it != state.coalesceIndex.end())
+        {
+            // Superseded message still waiting: overwrite it in place
+            QueuedWrite &queued = state.writeQueue[it->second - state.queueHeadSeq];
+            state.queuedBytes = state.queuedBytes - queued.data->size() + size;
+            queuedWriteBytes_.fetch_add(size, std::memory_order_relaxed);
+            queuedWriteBytes_.fetch_sub(queued.data->size(), std::memory_order_relaxed);
+            queued.data = std::move(data);
+            ++state.coalescedMessages;
+            return;
+        }
+        state.coalesceIndex.emplace(coalesceKey, state.queueHeadSeq + state.writeQueue.size());
+    }
+
+    state.writeQueue.push_back(QueuedWrite{std::move(data), std::move(coalesceKey)});
+    state.queuedBytes += size;
+    state.peakQueuedBytes = std::max(state.peakQueuedBytes, state.queuedBytes);
+    queuedWriteBytes_.fetch_add(size, std::memory_order_relaxed);
+}
+
+NetworkManager::QueuedWrite
+NetworkManager::popWrite(SocketWriteState &state)
+{
+    QueuedWrite queued = std::move(state.writeQueue.front());
+    state.writeQueue.pop_front();
+    if (!queued.coalesceKey.empty())
+        state.coalesceIndex.erase(queued.coalesceKey);
+    ++state.queueHeadSeq;
+
+    state.queuedBytes -= queued.data->size();
+    queuedWriteBytes_.fetch_sub(queued.data->size(), std::memory_order_relaxed);
+    return queued;
+}
+
+void
+NetworkManager::clearWriteQueue(SocketWriteState &state)
+{
+    queuedWriteBytes_.fetch_sub(state.queuedBytes, std::memory_order_relaxed);
+    state.queueHeadSeq += state.writeQueue.size();
+    state.writeQueue.clear();
+    state.coalesceIndex.clear();
+    state.queuedBytes = 0;
+}
+
+void
+NetworkManager::applyBackPressure(const std::shared_ptr<boost::asio::ip::tcp::socket> &socket, SocketWriteState &state)
+{
+    if (!state.aboveHighWatermark)
+    {
+        state.aboveHighWatermark = true;
+        log_->warn("Write queue above high watermark: {} bytes / {} messages queued",
+            state.queuedBytes,
+            state.writeQueue.size());
+    }
+
+    const WriteQueueStatus status{socket.get(), state.queuedBytes, state.writeQueue.size(), writeHighWatermark_, writeHardLimit_};
+    const SlowConsumerAction action = slowConsumerPolicy_ ? slowConsumerPolicy_(status) : SlowConsumerAction::Queue;
+
+    switch (action)
+    {
+    case SlowConsumerAction::Queue:
+        break;
+    case SlowConsumerAction::PauseReading:
+        if (!state.readingPaused)
+        {
+            state.readingPaused = true;
+            setSessionReadingPaused(socket.get(), true);
+        }
+        break;
+    case SlowConsumerAction::Disconnect:
+    {
+        log_->error("Disconnecting slow consumer: {} bytes / {} messages queued",
+            state.queuedBytes,
+            state.writeQueue.size());
+        // The pending read then fails and ClientSession runs its normal disconnect path
+        clearWriteQueue(state);
+        if (state.readingPaused)
+        {
+            state.readingPaused = false;
+            setSessionReadingPaused(socket.get(), false);
+        }
+        boost::system::error_code ec;
+        socket->close(ec);
+        if (!state.writePending)
+            removeSocketState(socket.get());
+        break;
+    }
+    }
+}
+
+void
+NetworkManager::releaseBackPressure(SocketWriteState &state, boost::asio::ip::tcp::socket *socket)
+{
+    if (!state.aboveHighWatermark || state.queuedBytes > writeLowWatermark_)
+        return;
+
+    state.aboveHighWatermark = false;
+    log_->info("Write queue back below low watermark ({} bytes queued)", state.queuedBytes);
+    if (state.readingPaused)
+    {
+        state.readingPaused = false;
+        setSessionReadingPaused(socket, false);
+    }
+}
+
+void
+NetworkManager::setSessionReadingPaused(boost::asio::ip::tcp::socket *socket, bool paused)
+{
+    std::shared_ptr<ClientSession> session;
+    {
+        // Only hit on watermark transitions, so a scan of the (small) session set is fine
+        std::lock_guard<std::mutex> lock(sessionsMutex_);
+        for (const auto &candidate : activeSessions_)
+        {
+            if (candidate->getSocket().get() == socket)
+            {
+                session = candidate;
+                break;
+            }
+        }
+    }
+    if (!session)
+        return;
+
+    if (paused)
+        session->pauseReading();
+    else
+        session->resumeReading();
 }
 
 std::shared_ptr<NetworkManager::SocketWriteState>
@@ -138,8 +440,32 @@ NetworkManager::getOrCreateSocketState(boost::asio::ip::tcp::socket *sock)
 void
 NetworkManager::removeSocketState(boost::asio::ip::tcp::socket *sock)
 {
-    std::lock_guard<std::mutex> lock(socketStatesMutex_);
-    socketStates_.erase(sock);
+    std::shared_ptr<SocketWriteState> state;
+    {
+        std::lock_guard<std::mutex> lock(socketStatesMutex_);
+        auto it = socketStates_.find(sock);
+        if (it == socketStates_.end())
+            return;
+        state = std::move(it->second);
+        socketStates_.erase(it);
+    }
+
+    // Called from the socket's strand, so the counters are stable here
+    if (state->writesIssued > 0)
+    {
+        log_->info("Socket write stats: {} writes, {} messages, {} bytes "
+                   "(avg {:.1f} msgs / {} bytes per write, max {} msgs / {} bytes), "
+                   "peak queued {} bytes, {} superseded messages coalesced",
+            state->writesIssued,
+            state->messagesWritten,
+            state->bytesWritten,
+            static_cast<double>(state->messagesWritten) / state->writesIssued,
+            state->bytesWritten / state->writesIssued,
+            state->maxMessagesPerWrite,
+            state->maxBytesPerWrite,
+            state->peakQueuedBytes,
+            state->coalescedMessages);
+    }
 }
 
 void
@@ -150,75 +476,111 @@ NetworkManager::doNextWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket
     {
         state->writePending = false;
         if (!socket->is_open())
+        {
+            clearWriteQueue(*state);
             removeSocketState(socket.get());
+        }
         return;
     }
 
     state->writePending = true;
-    auto dataPtr = state->writeQueue.front();
-    state->writeQueue.pop();
 
+    // Gather everything queued (up to the byte cap) into one scatter-gather write,
+    // so a burst of responses costs one syscall/completion instead of one each.
+    // The first message is always taken, even if it alone exceeds the cap.
+    state->inFlight.clear();
+    state->gatherBuffers.clear();
+    size_t batchBytes = 0;
+    while (!state->writeQueue.empty())
+    {
+        const auto &next = state->writeQueue.front().data;
+        if (!state->inFlight.empty() && batchBytes + next->size() > maxWriteBatchBytes_)
+            break;
+        batchBytes += next->size();
+        state->gatherBuffers.push_back(boost::asio::buffer(*next));
+        state->inFlight.push_back(popWrite(*state).data);
+    }
+    releaseBackPressure(*state, socket.get());
+
+    const size_t batchMessages = state->inFlight.size();
+    ++state->writesIssued;
+    state->messagesWritten += batchMessages;
+    state->bytesWritten += batchBytes;
+    state->maxMessagesPerWrite = std::max(state->maxMessagesPerWrite, batchMessages);
+    state->maxBytesPerWrite = std::max(state->maxBytesPerWrite, batchBytes);
+
+    // inFlight (owned by state) keeps the gathered strings alive until completion
     boost::asio::async_write(
         *socket,
-        boost::asio::buffer(*dataPtr),
+        state->gatherBuffers,
         boost::asio::bind_executor(
             state->strand,
-            [this, socket, dataPtr, state](const boost::system::error_code &error, size_t bytes_transferred) mutable
+            [this, socket, state, batchMessages](const boost::system::error_code &error, size_t bytes_transferred) mutable
             {
+                state->inFlight.clear();
                 if (error)
                 {
                     log_->error("Error during async_write: " + error.message());
                     boost::system::error_code close_ec;
                     if (socket->is_open())
                         socket->close(close_ec);
+                    clearWriteQueue(*state);
                     removeSocketState(socket.get());
                     return;
                 }
-                log_->debug("Bytes sent: " + std::to_string(bytes_transferred));
-                boost::system::error_code ec;
-                auto ep = socket->remote_endpoint(ec);
-                if (!ec)
-                    logger_.log("Data sent to: " + ep.address().to_string() + ":" + std::to_string(ep.port()), BLUE);
+                // remote_endpoint() is a syscall, only made when trace is enabled
+                GS_LOG_TRACE(log_, "Sent {} bytes in {} message(s) to {}", bytes_transferred, batchMessages, describePeer(*socket));
                 doNextWrite(std::move(socket), std::move(state));
             }));
 }
 
+namespace
+{
+// Largest recent envelope size on this thread (decaying, capped so one catalog does not
+// inflate every later response), reserved up front so the envelope is written without
+// regrowing and then moved out rather than copied
+constexpr std::size_t MAX_ENVELOPE_SIZE_HINT = 64 * 1024;
+thread_local std::size_t envelopeSizeHint = 256;
+} // namespace
+
+// Writes {"body":<body>,"header":{<caller fields>,"status":..,"timestamp":..,"version":"1.0"}}\n
+// straight into the result string; the body and caller header fields are serialised
+// in place rather than copied into a new envelope document first.
 std::string
-NetworkManager::generateResponseMessage(const std::string &status, const nlohmann::json &message)
+NetworkManager::buildEnvelope(const std::string &status, const nlohmann::json &message, const TimestampStruct *timestamps)
 {
-    nlohmann::json response;
-    std::string currentTimestamp = TimestampUtils::getCurrentTimestamp();
-    response["header"] = message["header"];
-    response["header"]["status"] = status;
-    response["header"]["timestamp"] = currentTimestamp;
-    response["header"]["version"] = "1.0";
-    response["body"] = message["body"];
+    std::string out;
+    out.reserve(envelopeSizeHint);
+    JsonStreamWriter writer(out);
 
-    std::string responseString = response.dump();
-    log_->info("Response generated: " + responseString);
-    return responseString + "\n";
+    writer.beginObject().key("body");
+    auto body = message.find("body");
+    if (body != message.end())
+        writer.value(*body);
+    else
+        writer.value(nullptr);
+
+    auto header = message.find("header");
+    writeEnvelopeHeader(writer, status, header != message.end() ? &*header : nullptr, timestamps);
+    writer.endObject();
+    out.push_back('\n');
+
+    envelopeSizeHint = std::min(MAX_ENVELOPE_SIZE_HINT, std::max(out.size(), envelopeSizeHint - envelopeSizeHint / 8));
+    GS_LOG_DEBUG(log_, "Response generated ({} bytes)", out.size());
+    return out;
 }
 
 std::string
-NetworkManager::generateResponseMessage(const std::string &status, const nlohmann::json &message, const TimestampStruct &timestamps)
+NetworkManager::generateResponseMessage(const std::string &status, const nlohmann::json &message)
 {
-    nlohmann::json response;
-    std::string currentTimestamp = TimestampUtils::getCurrentTimestamp();
-    response["header"] = message["header"];
-    response["header"]["status"] = status;
-    response["header"]["timestamp"] = currentTimestamp;
-    response["header"]["version"] = "1.0";
-
-    // Add lag compensation timestamps to header
-    TimestampStruct finalTimestamps = timestamps;
-    TimestampUtils::setServerSendTimestamp(finalTimestamps); // Set serverSendMs to current time
-    TimestampUtils::addTimestampsToHeader(response, finalTimestamps);
-
-    response["body"] = message["body"];
+    return buildEnvelope(status, message, nullptr);
+}
 
-    std::string responseString = response.dump();
-    log_->info("Response with timestamps generated: " + responseString);
-    return responseString + "\n";
+std::string
+NetworkManager::generateResponseMessage(const std::string &status, const nlohmann::json &message, const TimestampStruct &timestamps)
+{
+    // serverSendMs is stamped with the current time, as the lag compensation expects
+    return buildEnvelope(status, message, &timestamps);
 }
 
 void
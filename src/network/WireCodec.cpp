@@ -0,0 +1,170 @@
+#include "network/WireCodec.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+// Envelope map header and keys, pre-encoded: {"body": ..., "header": ...}
+constexpr char MSGPACK_ENVELOPE_START[] = "\x82\xa4"
+                                          "body";
+constexpr char MSGPACK_HEADER_KEY[] = "\xa6"
+                                      "header";
+constexpr char CBOR_ENVELOPE_START[] = "\xa2\x64"
+                                       "body";
+constexpr char CBOR_HEADER_KEY[] = "\x66"
+                                   "header";
+
+void
+encodeValue(const nlohmann::json &value, WireFormat format, std::string &out)
+{
+    if (format == WireFormat::MessagePack)
+        nlohmann::json::to_msgpack(value, out);
+    else
+        nlohmann::json::to_cbor(value, out);
+}
+
+void
+writeLengthPrefix(std::string &frame, std::size_t payloadSize)
+{
+    if (payloadSize > UINT32_MAX)
+        throw std::length_error("Frame payload too large for length prefix");
+    frame[0] = static_cast<char>((payloadSize >> 24) & 0xff);
+    frame[1] = static_cast<char>((payloadSize >> 16) & 0xff);
+    frame[2] = static_cast<char>((payloadSize >> 8) & 0xff);
+    frame[3] = static_cast<char>(payloadSize & 0xff);
+}
+} // namespace
+
+std::optional<WireFormat>
+WireCodec::fromName(std::string_view name)
+{
+    if (name == "json")
+        return WireFormat::Json;
+    if (name == "msgpack" || name == "messagepack")
+        return WireFormat::MessagePack;
+    if (name == "cbor")
+        return WireFormat::Cbor;
+    return std::nullopt;
+}
+
+const char *
+WireCodec::name(WireFormat format)
+{
+    switch (format)
+    {
+    case WireFormat::MessagePack:
+        return "msgpack";
+    case WireFormat::Cbor:
+        return "cbor";
+    case WireFormat::Json:
+    default:
+        return "json";
+    }
+}
+
+std::size_t
+WireCodec::readLengthPrefix(const char *data)
+{
+    const auto *bytes = reinterpret_cast<const unsigned char *>(data);
+    return (static_cast<std::size_t>(bytes[0]) << 24) |
+           (static_cast<std::size_t>(bytes[1]) << 16) |
+           (static_cast<std::size_t>(bytes[2]) << 8) |
+           static_cast<std::size_t>(bytes[3]);
+}
+
+nlohmann::json
+WireCodec::decode(std::string_view payload, WireFormat format)
+{
+    const char *begin = payload.data();
+    const char *end = payload.data() + payload.size();
+    switch (format)
+    {
+    case WireFormat::MessagePack:
+        return nlohmann::json::from_msgpack(begin, end);
+    case WireFormat::Cbor:
+        return nlohmann::json::from_cbor(begin, end);
+    case WireFormat::Json:
+    default:
+        return nlohmann::json::parse(begin, end);
+    }
+}
+
+std::string
+WireCodec::encodeFrame(const nlohmann::json &envelope, WireFormat format)
+{
+    if (format == WireFormat::Json)
+        return envelope.dump() + "\n";
+
+    std::string frame(LENGTH_PREFIX_SIZE, '\0');
+    encodeValue(envelope, format, frame);
+    writeLengthPrefix(frame, frame.size() - LENGTH_PREFIX_SIZE);
+    return frame;
+}
+
+std::string
+WireCodec::encodeFrame(const nlohmann::json &body, const nlohmann::json &header, WireFormat format)
+{
+    if (format == WireFormat::Json)
+        return "{\"body\":" + body.dump() + ",\"header\":" + header.dump() + "}\n";
+
+    std::string frame(LENGTH_PREFIX_SIZE, '\0');
+    if (format == WireFormat::MessagePack)
+        frame.append(MSGPACK_ENVELOPE_START, sizeof(MSGPACK_ENVELOPE_START) - 1);
+    else
+        frame.append(CBOR_ENVELOPE_START, sizeof(CBOR_ENVELOPE_START) - 1);
+    encodeValue(body, format, frame);
+    if (format == WireFormat::MessagePack)
+        frame.append(MSGPACK_HEADER_KEY, sizeof(MSGPACK_HEADER_KEY) - 1);
+    else
+        frame.append(CBOR_HEADER_KEY, sizeof(CBOR_HEADER_KEY) - 1);
+    encodeValue(header, format, frame);
+    writeLengthPrefix(frame, frame.size() - LENGTH_PREFIX_SIZE);
+    return frame;
+}
+
+std::string
+WireCodec::transcodeFrame(const std::string &jsonFrame, WireFormat format)
+{
+    if (format == WireFormat::Json)
+        return jsonFrame;
+    // The trailing newline is whitespace to the JSON parser
+    return encodeFrame(nlohmann::json::parse(jsonFrame), format);
+}
+
+WireCodec::PreparedEnvelope
+WireCodec::prepare(const nlohmann::json &envelope, WireFormat format)
+{
+    if (format == WireFormat::Json || !envelope.is_object() || envelope.size() != 2 ||
+        !envelope.contains("body") || !envelope.contains("header"))
+    {
+        throw std::invalid_argument("WireCodec::prepare expects a {header, body} envelope and a binary format");
+    }
+
+    PreparedEnvelope prepared;
+    if (format == WireFormat::MessagePack)
+        prepared.encodedBody.append(MSGPACK_ENVELOPE_START, sizeof(MSGPACK_ENVELOPE_START) - 1);
+    else
+        prepared.encodedBody.append(CBOR_ENVELOPE_START, sizeof(CBOR_ENVELOPE_START) - 1);
+    encodeValue(envelope["body"], format, prepared.encodedBody);
+    prepared.header = envelope["header"];
+    return prepared;
+}
+
+std::string
+WireCodec::finishFrame(const PreparedEnvelope &prepared, const nlohmann::json &header, WireFormat format)
+{
+    std::string encodedHeader;
+    if (format == WireFormat::MessagePack)
+        encodedHeader.append(MSGPACK_HEADER_KEY, sizeof(MSGPACK_HEADER_KEY) - 1);
+    else
+        encodedHeader.append(CBOR_HEADER_KEY, sizeof(CBOR_HEADER_KEY) - 1);
+    encodeValue(header, format, encodedHeader);
+
+    std::string frame;
+    frame.reserve(LENGTH_PREFIX_SIZE + prepared.encodedBody.size() + encodedHeader.size());
+    frame.resize(LENGTH_PREFIX_SIZE);
+    frame.append(prepared.encodedBody);
+    frame.append(encodedHeader);
+    writeLengthPrefix(frame, frame.size() - LENGTH_PREFIX_SIZE);
+    return frame;
+}
@@ -0,0 +1,473 @@
+#include "services/AnalyticsSink.hpp"
+#include "utils/LogMacros.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <spdlog/logger.h>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+// COPY text format: tab separated, \N for NULL, backslash escapes for the separators
+void
+appendCopyField(std::string &line, std::string_view text)
+{
+    for (char c : text)
+    {
+        switch (c)
+        {
+        case '\\':
+            line += "\\\\";
+            break;
+        case '\t':
+            line += "\\t";
+            break;
+        case '\n':
+            line += "\\n";
+            break;
+        case '\r':
+            line += "\\r";
+            break;
+        default:
+            line.push_back(c);
+        }
+    }
+}
+
+// Reverses appendCopyField; false on a dangling backslash
+bool
+readCopyField(std::string_view text, std::string &out)
+{
+    out.clear();
+    out.reserve(text.size());
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        if (text[i] != '\\')
+        {
+            out.push_back(text[i]);
+            continue;
+        }
+        if (++i == text.size())
+            return false;
+        switch (text[i])
+        {
+        case 't':
+            out.push_back('\t');
+            break;
+        case 'n':
+            out.push_back('\n');
+            break;
+        case 'r':
+            out.push_back('\r');
+            break;
+        default:
+            out.push_back(text[i]);
+        }
+    }
+    return true;
+}
+
+bool
+readIntField(std::string_view text, int &value)
+{
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc() && end == text.data() + text.size();
+}
+
+const std::vector<std::string> ANALYTICS_COLUMNS{
+    "event_type", "character_id", "session_id", "level", "zone_id", "payload"};
+} // namespace
+
+AnalyticsSink::AnalyticsSink(Database &database, Logger &logger)
+    : database_(database)
+{
+    log_ = logger.getSystem("analytics");
+}
+
+AnalyticsSink::~AnalyticsSink()
+{
+    stop();
+}
+
+void
+AnalyticsSink::start(const AnalyticsSinkSettings &settings)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        settings_ = settings;
+        settings_.flushRows = std::max<std::size_t>(1, settings_.flushRows);
+        settings_.flushInterval = std::max(std::chrono::milliseconds(1), settings_.flushInterval);
+    }
+    if (!writer_.joinable())
+        writer_ = std::thread(&AnalyticsSink::writerLoop, this);
+
+    log_->info("Analytics sink started: flush every {} rows or {} ms, buffer limit {} bytes, overflow {}",
+        settings_.flushRows, settings_.flushInterval.count(), settings_.maxBufferedBytes,
+        settings_.spillPath.empty() ? std::string("drops oldest rows") : "spills to " + settings_.spillPath);
+}
+
+void
+AnalyticsSink::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopFlag_)
+            return;
+        stopFlag_ = true;
+    }
+    cv_.notify_all();
+    // The writer makes a final pass on its way out; without one, make it here
+    if (writer_.joinable())
+        writer_.join();
+    else
+        writerLoop();
+
+    const AnalyticsSinkStats stats = getStats();
+    log_->info("Analytics sink stopped: recorded={} flushed={} spilled={} dropped={} failedFlushes={}",
+        stats.recorded, stats.flushed, stats.spilled, stats.dropped, stats.failedFlushes);
+}
+
+void
+AnalyticsSink::record(const std::string &eventType, int characterId, const std::string &sessionId,
+    int level, int zoneId, const std::string &payloadJson)
+{
+    Row row;
+    row.eventType = eventType;
+    if (characterId != 0)
+        row.characterId = characterId;
+    row.sessionId = sessionId;
+    row.level = level;
+    row.zoneId = zoneId;
+    row.payload = payloadJson;
+    row.recordedAt = std::chrono::steady_clock::now();
+
+    std::deque<Row> overflow;
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.recorded;
+        bufferedBytes_ += rowBytes(row);
+        buffer_.push_back(std::move(row));
+        trimLocked(overflow);
+        wake = buffer_.size() >= settings_.flushRows;
+    }
+    if (!overflow.empty())
+        spill(overflow);
+    if (wake)
+        cv_.notify_one();
+}
+
+AnalyticsSinkStats
+AnalyticsSink::getStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    AnalyticsSinkStats stats = stats_;
+    stats.bufferedRows = buffer_.size();
+    stats.bufferedBytes = bufferedBytes_;
+    stats.oldestBufferedMs = buffer_.empty()
+                                 ? 0
+                                 : std::chrono::duration_cast<std::chrono::milliseconds>(
+                                       std::chrono::steady_clock::now() - buffer_.front().recordedAt)
+                                       .count();
+    return stats;
+}
+
+void
+AnalyticsSink::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool backoff = false;
+    while (true)
+    {
+        // After a failed flush wait out the whole interval instead of retrying on every full buffer
+        cv_.wait_for(lock, settings_.flushInterval, [this, backoff]
+            { return stopFlag_ || (!backoff && buffer_.size() >= settings_.flushRows); });
+        const bool stopping = stopFlag_;
+
+        std::deque<Row> batch;
+        batch.swap(buffer_);
+        const std::size_t batchBytes = bufferedBytes_;
+        bufferedBytes_ = 0;
+        lock.unlock();
+
+        // Spilled rows are older than anything in memory, so they go first
+        bool ok = replaySpill();
+        if (ok && !batch.empty())
+            ok = copyRows(batch);
+
+        std::deque<Row> overflow;
+        lock.lock();
+        backoff = !ok;
+        if (!ok)
+            ++stats_.failedFlushes;
+        if (!batch.empty())
+        {
+            if (ok)
+            {
+                stats_.flushed += batch.size();
+                stats_.lastFlushLagMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - batch.front().recordedAt)
+                                            .count();
+                overflowWarned_ = false;
+                GS_LOG_DEBUG(log_, "Flushed {} analytics rows, lag {} ms", batch.size(), stats_.lastFlushLagMs);
+            }
+            else
+            {
+                // Back in front of the rows recorded meanwhile, then re-apply the memory bound
+                buffer_.insert(buffer_.begin(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+                bufferedBytes_ += batchBytes;
+                trimLocked(overflow);
+            }
+        }
+        if (!overflow.empty())
+        {
+            lock.unlock();
+            spill(overflow);
+            lock.lock();
+        }
+        if (stopping)
+            break;
+    }
+
+    // Whatever the final pass could not write: keep it on disk if configured, otherwise it is lost
+    std::deque<Row> rest;
+    rest.swap(buffer_);
+    bufferedBytes_ = 0;
+    lock.unlock();
+
+    if (settings_.spillPath.empty())
+    {
+        if (!rest.empty())
+        {
+            lock.lock();
+            stats_.dropped += rest.size();
+            lock.unlock();
+            log_->warn("Dropped {} unflushed analytics rows on shutdown", rest.size());
+        }
+        return;
+    }
+    spill(rest);
+}
+
+bool
+AnalyticsSink::copyRows(const std::deque<Row> &rows)
+{
+    try
+    {
+        auto sc = database_.getConnectionLocked();
+        pqxx::work txn(sc.get());
+        pqxx::stream_to stream(txn, "game_analytics", ANALYTICS_COLUMNS);
+        for (const auto &row : rows)
+            writeRow(stream, row);
+        stream.complete();
+        txn.commit();
+        return true;
+    }
+    catch (const std::exception &e)
+    {
+        log_->warn("COPY of {} analytics rows failed, keeping them buffered", rows.size());
+        database_.handleDatabaseError(e);
+        return false;
+    }
+}
+
+bool
+AnalyticsSink::replaySpill()
+{
+    if (settings_.spillPath.empty())
+        return true;
+
+    // New overflow keeps going to spillPath while the previous file is replayed under another name
+    const std::string replayPath = settings_.spillPath + ".replay";
+    std::error_code ec;
+    {
+        std::lock_guard<std::mutex> lock(spillMutex_);
+        if (!std::filesystem::exists(replayPath, ec))
+        {
+            if (!std::filesystem::exists(settings_.spillPath, ec))
+                return true;
+            std::filesystem::rename(settings_.spillPath, replayPath, ec);
+            if (ec)
+            {
+                log_->error("Cannot move analytics spill file {} aside: {}", settings_.spillPath, ec.message());
+                return false;
+            }
+        }
+    }
+
+    std::ifstream in(replayPath);
+    std::uint64_t rows = 0;
+    std::uint64_t unreadable = 0;
+    try
+    {
+        auto sc = database_.getConnectionLocked();
+        pqxx::work txn(sc.get());
+        pqxx::stream_to stream(txn, "game_analytics", ANALYTICS_COLUMNS);
+        std::string line;
+        Row row;
+        while (std::getline(in, line))
+        {
+            if (line.empty())
+                continue;
+            // e.g. a line torn by a crash while spilling
+            if (!fromSpillLine(line, row))
+            {
+                ++unreadable;
+                continue;
+            }
+            writeRow(stream, row);
+            ++rows;
+        }
+        stream.complete();
+        txn.commit();
+    }
+    catch (const pqxx::broken_connection &e)
+    {
+        database_.handleDatabaseError(e);
+        return false;
+    }
+    catch (const pqxx::sql_error &e)
+    {
+        // Postgres rejected the file's contents; retrying cannot
+        // succeed, so set it aside for inspection rather than blocking every later flush
+        in.close();
+        std::filesystem::rename(replayPath, replayPath + ".rejected", ec);
+        log_->error("Analytics spill file rejected, moved to {}.rejected: {}", replayPath, e.what());
+        return true;
+    }
+    catch (const std::exception &e)
+    {
+        database_.handleDatabaseError(e);
+        return false;
+    }
+
+    in.close();
+    std::filesystem::remove(replayPath, ec);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.flushed += rows;
+    }
+    log_->info("Replayed {} spilled analytics rows", rows);
+    if (unreadable > 0)
+        log_->warn("Skipped {} unreadable lines in analytics spill file {}", unreadable, replayPath);
+    return true;
+}
+
+void
+AnalyticsSink::trimLocked(std::deque<Row> &overflow)
+{
+    if (bufferedBytes_ <= settings_.maxBufferedBytes)
+        return;
+
+    std::size_t removed = 0;
+    while (bufferedBytes_ > settings_.maxBufferedBytes && !buffer_.empty())
+    {
+        bufferedBytes_ -= rowBytes(buffer_.front());
+        if (settings_.spillPath.empty())
+            ++stats_.dropped;
+        else
+            overflow.push_back(std::move(buffer_.front()));
+        buffer_.pop_front();
+        ++removed;
+    }
+
+    if (!overflowWarned_)
+    {
+        overflowWarned_ = true;
+        log_->warn("Analytics buffer over {} bytes, Postgres is falling behind; {} oldest rows {}",
+            settings_.maxBufferedBytes, removed, settings_.spillPath.empty() ? "dropped" : "spilled");
+    }
+}
+
+void
+AnalyticsSink::spill(std::deque<Row> &rows)
+{
+    if (rows.empty())
+        return;
+
+    bool ok;
+    {
+        std::lock_guard<std::mutex> lock(spillMutex_);
+        std::ofstream out(settings_.spillPath, std::ios::app);
+        for (const auto &row : rows)
+        {
+            out << toSpillLine(row) << '\n';
+        }
+        out.flush();
+        ok = static_cast<bool>(out);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ok)
+            stats_.spilled += rows.size();
+        else
+            stats_.dropped += rows.size();
+    }
+    if (!ok)
+        log_->error("Cannot write analytics spill file {}, dropped {} rows", settings_.spillPath, rows.size());
+    rows.clear();
+}
+
+std::size_t
+AnalyticsSink::rowBytes(const Row &row)
+{
+    return sizeof(Row) + row.eventType.capacity() + row.sessionId.capacity() + row.payload.capacity();
+}
+
+std::string
+AnalyticsSink::toSpillLine(const Row &row)
+{
+    std::string line;
+    line.reserve(row.eventType.size() + row.sessionId.size() + row.payload.size() + 48);
+    appendCopyField(line, row.eventType);
+    line.push_back('\t');
+    line += row.characterId ? std::to_string(*row.characterId) : "\\N";
+    line.push_back('\t');
+    appendCopyField(line, row.sessionId);
+    line.push_back('\t');
+    line += std::to_string(row.level);
+    line.push_back('\t');
+    line += std::to_string(row.zoneId);
+    line.push_back('\t');
+    appendCopyField(line, row.payload);
+    return line;
+}
+
+bool
+AnalyticsSink::fromSpillLine(const std::string &line, Row &row)
+{
+    std::array<std::string_view, 6> fields;
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < fields.size(); ++i)
+    {
+        const std::size_t end = line.find('\t', start);
+        if ((end == std::string::npos) != (i + 1 == fields.size()))
+            return false;
+        fields[i] = std::string_view(line).substr(start, end == std::string::npos ? std::string::npos : end - start);
+        start = end + 1;
+    }
+
+    int characterId = 0;
+    if (fields[1] == "\\N")
+        row.characterId.reset();
+    else if (readIntField(fields[1], characterId))
+        row.characterId = characterId;
+    else
+        return false;
+
+    return readCopyField(fields[0], row.eventType) && readCopyField(fields[2], row.sessionId) &&
+           readIntField(fields[3], row.level) && readIntField(fields[4], row.zoneId) &&
+           readCopyField(fields[5], row.payload);
+}
+
+void
+AnalyticsSink::writeRow(pqxx::stream_to &stream, const Row &row)
+{
+    stream << std::make_tuple(row.eventType, row.characterId, row.sessionId, row.level, row.zoneId, row.payload);
+}
@@ -0,0 +1,424 @@
+#include "services/CharacterAttributeService.hpp"
+#include <algorithm>
+#include <cmath>
+#include <spdlog/logger.h>
+#include <string_view>
+
+namespace
+{
+// Slot key for equipment rows without a slot; keeps them distinct per inventory item
+std::string
+slotKey(const pqxx::row &row)
+{
+    if (!row["slot_slug"].is_null())
+        return row["slot_slug"].as<std::string>();
+    return "#" + std::to_string(row["inventory_item_id"].as<int>());
+}
+} // namespace
+
+CharacterAttributeService::CharacterAttributeService(Database &database, Logger &logger)
+    : database_(database), logger_(logger)
+{
+    log_ = logger.getSystem("attributes");
+    loadStaticData();
+}
+
+void
+CharacterAttributeService::loadStaticData()
+{
+    try
+    {
+        auto tables = std::make_shared<StaticTables>();
+
+        auto _dbConn = database_.getConnectionLocked();
+        pqxx::work txn(_dbConn.get());
+        pqxx::result formulas = database_.executeQueryWithTransaction(txn, "get_class_stat_formulas", {});
+        pqxx::result itemStats = database_.executeQueryWithTransaction(txn, "get_item_equip_stats_all", {});
+        pqxx::result setMembers = database_.executeQueryWithTransaction(txn, "get_item_set_memberships", {});
+        pqxx::result setBonuses = database_.executeQueryWithTransaction(txn, "get_item_set_bonuses_all", {});
+        pqxx::result tiers = database_.executeQueryWithTransaction(txn, "get_durability_tiers", {});
+        txn.commit();
+
+        for (const auto &row : formulas)
+        {
+            ClassFormula formula;
+            formula.attributeId = row["attribute_id"].as<int>();
+            formula.name = row["name"].as<std::string>();
+            formula.slug = row["slug"].as<std::string>();
+            formula.baseValue = row["base_value"].as<double>();
+            formula.multiplier = row["multiplier"].as<double>();
+            formula.exponent = row["exponent"].as<double>();
+            tables->formulasByClass[row["class_id"].as<int>()].push_back(std::move(formula));
+        }
+        for (auto &[classId, list] : tables->formulasByClass)
+        {
+            std::sort(list.begin(), list.end(), [](const ClassFormula &a, const ClassFormula &b)
+                { return a.attributeId < b.attributeId; });
+        }
+
+        for (const auto &row : itemStats)
+        {
+            auto &stats = tables->items[row["item_id"].as<int>()];
+            stats.isDurable = row["is_durable"].as<bool>();
+            stats.durabilityMax = row["durability_max"].as<int>();
+            stats.attributes.emplace_back(row["attribute_id"].as<int>(), row["value"].as<int>());
+        }
+
+        for (const auto &row : setMembers)
+            tables->setsByItem[row["item_id"].as<int>()].push_back(row["set_id"].as<int>());
+
+        for (const auto &row : setBonuses)
+        {
+            SetBonus bonus;
+            bonus.piecesRequired = row["pieces_required"].as<int>();
+            bonus.attributeId = row["attribute_id"].as<int>();
+            bonus.value = row["bonus_value"].as<int>();
+            tables->setBonuses[row["set_id"].as<int>()].push_back(bonus);
+        }
+
+        for (const auto &row : tiers)
+        {
+            // durability.tier<N>_threshold_pct / durability.tier<N>_penalty_pct
+            const auto key = row["key"].as<std::string>();
+            constexpr std::string_view prefix = "durability.tier";
+            if (key.size() <= prefix.size() + 1 || key.compare(0, prefix.size(), prefix) != 0)
+                continue;
+            const int tier = key[prefix.size()] - '1';
+            if (tier < 0 || tier > 2 || row["value"].is_null())
+                continue;
+            const std::string_view suffix = std::string_view(key).substr(prefix.size() + 1);
+            if (suffix == "_threshold_pct")
+                tables->durabilityTiers[tier].threshold = row["value"].as<double>();
+            else if (suffix == "_penalty_pct")
+                tables->durabilityTiers[tier].penalty = row["value"].as<double>();
+        }
+
+        const size_t classCount = tables->formulasByClass.size();
+        const size_t itemCount = tables->items.size();
+        {
+            std::lock_guard<std::mutex> lock(tablesMutex_);
+            tables_ = std::move(tables);
+        }
+
+        log_->info("Loaded attribute tables: {} class formulas, {} items with equip stats", classCount, itemCount);
+    }
+    catch (const std::exception &e)
+    {
+        log_->error("CharacterAttributeService::loadStaticData error: {}", e.what());
+    }
+}
+
+void
+CharacterAttributeService::reload()
+{
+    // Cached characters rebuild their derived equipment bonuses on next use
+    loadStaticData();
+}
+
+std::shared_ptr<const CharacterAttributeService::StaticTables>
+CharacterAttributeService::currentTables()
+{
+    std::lock_guard<std::mutex> lock(tablesMutex_);
+    if (!tables_)
+        tables_ = std::make_shared<StaticTables>();
+    return tables_;
+}
+
+int
+CharacterAttributeService::equipValue(const StaticTables &tables, const ItemEquipStats &stats, int value, const EquippedItem &item)
+{
+    if (!stats.isDurable || stats.durabilityMax == 0)
+        return value;
+    const int durability = item.durabilityCurrent.value_or(stats.durabilityMax);
+    if (durability == 0)
+        return 0;
+
+    const double ratio = static_cast<double>(durability) / stats.durabilityMax;
+    // Worst tier first, as in the CASE it replaces; float rounding like ROUND(float8)
+    for (int tier = 2; tier >= 0; --tier)
+    {
+        const auto &t = tables.durabilityTiers[tier];
+        if (!t.threshold || ratio >= *t.threshold)
+            continue;
+        if (!t.penalty)
+            return 0; // NULL result, skipped by SUM
+        return static_cast<int>(std::nearbyint(value * (1.0 - *t.penalty)));
+    }
+    return value;
+}
+
+void
+CharacterAttributeService::applyItem(CharacterState &state, const StaticTables &tables, const EquippedItem &item, int sign)
+{
+    auto statsIt = tables.items.find(item.itemId);
+    if (statsIt != tables.items.end())
+    {
+        for (const auto &[attributeId, value] : statsIt->second.attributes)
+            state.equipBonus[attributeId] += sign * equipValue(tables, statsIt->second, value, item);
+    }
+
+    auto setsIt = tables.setsByItem.find(item.itemId);
+    if (setsIt != tables.setsByItem.end())
+    {
+        for (int setId : setsIt->second)
+            state.setPieces[setId] += sign;
+    }
+}
+
+void
+CharacterAttributeService::rebuildDerived(CharacterState &state, const std::shared_ptr<const StaticTables> &tables)
+{
+    state.equipBonus.clear();
+    state.setPieces.clear();
+    for (const auto &[slot, item] : state.equippedBySlot)
+        applyItem(state, *tables, item, +1);
+    state.derivedFrom = tables;
+}
+
+std::vector<CharacterAttributeStruct>
+CharacterAttributeService::compute(int characterId, const CharacterState &state, const StaticTables &tables)
+{
+    std::vector<CharacterAttributeStruct> attributes;
+    auto formulasIt = tables.formulasByClass.find(state.classId);
+    if (formulasIt == tables.formulasByClass.end())
+        return attributes;
+
+    std::unordered_map<int, int> setBonus;
+    for (const auto &[setId, pieces] : state.setPieces)
+    {
+        auto bonusesIt = tables.setBonuses.find(setId);
+        if (pieces <= 0 || bonusesIt == tables.setBonuses.end())
+            continue;
+        for (const auto &bonus : bonusesIt->second)
+        {
+            if (pieces >= bonus.piecesRequired)
+                setBonus[bonus.attributeId] += bonus.value;
+        }
+    }
+
+    auto bonusFor = [](const std::unordered_map<int, int> &bonuses, int attributeId)
+    {
+        auto it = bonuses.find(attributeId);
+        return it != bonuses.end() ? it->second : 0;
+    };
+
+    attributes.reserve(formulasIt->second.size());
+    for (const auto &formula : formulasIt->second)
+    {
+        CharacterAttributeStruct attr;
+        attr.id = formula.attributeId;
+        attr.character_id = characterId;
+        attr.name = formula.name;
+        attr.slug = formula.slug;
+        attr.value = static_cast<int>(std::round(formula.baseValue + formula.multiplier * std::pow(state.level, formula.exponent))) +
+                     bonusFor(state.permanentBonus, formula.attributeId) +
+                     bonusFor(state.equipBonus, formula.attributeId) +
+                     bonusFor(setBonus, formula.attributeId);
+        attributes.push_back(std::move(attr));
+    }
+    return attributes;
+}
+
+CharacterAttributeService::CharacterState
+CharacterAttributeService::readInputs(int classId, int level, const pqxx::result &equipment, const pqxx::result &permanentModifiers)
+{
+    CharacterState state;
+    state.classId = classId;
+    state.level = level;
+    for (const auto &row : permanentModifiers)
+        state.permanentBonus[row["attribute_id"].as<int>()] += row["bonus"].as<int>();
+    for (const auto &row : equipment)
+    {
+        EquippedItem item;
+        item.inventoryItemId = row["inventory_item_id"].as<int>();
+        item.itemId = row["item_id"].as<int>();
+        if (!row["durability_current"].is_null())
+            item.durabilityCurrent = row["durability_current"].as<int>();
+        state.equippedBySlot[slotKey(row)] = item;
+    }
+    return state;
+}
+
+CharacterAttributeService::CharacterState *
+CharacterAttributeService::findState(int characterId)
+{
+    auto it = states_.find(characterId);
+    if (it == states_.end())
+        return nullptr;
+    auto tables = currentTables();
+    if (it->second.derivedFrom != tables)
+        rebuildDerived(it->second, tables);
+    return &it->second;
+}
+
+void
+CharacterAttributeService::setCharacterInputs(int characterId, int classId, int level,
+    const pqxx::result &equipment, const pqxx::result &permanentModifiers)
+{
+    CharacterState state = readInputs(classId, level, equipment, permanentModifiers);
+    rebuildDerived(state, currentTables());
+
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    states_[characterId] = std::move(state);
+}
+
+std::vector<CharacterAttributeStruct>
+CharacterAttributeService::getAttributes(Database &db, int characterId)
+{
+    {
+        std::lock_guard<std::mutex> lock(statesMutex_);
+        if (const auto *state = findState(characterId))
+            return compute(characterId, *state, *state->derivedFrom);
+    }
+
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        pqxx::work txn(_dbConn.get());
+        pqxx::result classLevel = db.executeQueryWithTransaction(txn, "get_character_class_level", {characterId});
+        pqxx::result equipment = db.executeQueryWithTransaction(txn, "get_character_equipment_stats", {characterId});
+        pqxx::result modifiers = db.executeQueryWithTransaction(txn, "get_character_permanent_modifiers", {characterId});
+        txn.commit();
+
+        if (classLevel.empty())
+            return {};
+        setCharacterInputs(characterId, classLevel[0]["class_id"].as<int>(), classLevel[0]["level"].as<int>(), equipment, modifiers);
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    const auto *state = findState(characterId);
+    return state ? compute(characterId, *state, *state->derivedFrom) : std::vector<CharacterAttributeStruct>();
+}
+
+void
+CharacterAttributeService::setLevel(int characterId, int level)
+{
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    if (auto *state = findState(characterId))
+        state->level = level;
+}
+
+void
+CharacterAttributeService::equipItem(Database &db, int characterId, const std::string &slotSlug, int inventoryItemId)
+{
+    {
+        std::lock_guard<std::mutex> lock(statesMutex_);
+        if (states_.find(characterId) == states_.end())
+            return;
+    }
+
+    // The event only names the inventory row; its item and durability are one indexed lookup
+    EquippedItem item;
+    item.inventoryItemId = inventoryItemId;
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        pqxx::work txn(_dbConn.get());
+        pqxx::result rows = db.executeQueryWithTransaction(txn, "get_inventory_item_stats_source", {inventoryItemId, characterId});
+        txn.commit();
+        if (rows.empty())
+        {
+            forgetCharacter(characterId);
+            return;
+        }
+        item.itemId = rows[0]["item_id"].as<int>();
+        if (!rows[0]["durability_current"].is_null())
+            item.durabilityCurrent = rows[0]["durability_current"].as<int>();
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+        forgetCharacter(characterId);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    auto *state = findState(characterId);
+    if (!state)
+        return;
+    const auto &tables = *state->derivedFrom;
+
+    // The same inventory item moved to another slot, or a slot swap
+    for (auto it = state->equippedBySlot.begin(); it != state->equippedBySlot.end();)
+    {
+        if (it->second.inventoryItemId == inventoryItemId || it->first == slotSlug)
+        {
+            applyItem(*state, tables, it->second, -1);
+            it = state->equippedBySlot.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    state->equippedBySlot[slotSlug] = item;
+    applyItem(*state, tables, item, +1);
+}
+
+void
+CharacterAttributeService::unequipItem(int characterId, int inventoryItemId)
+{
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    auto *state = findState(characterId);
+    if (!state)
+        return;
+    for (auto it = state->equippedBySlot.begin(); it != state->equippedBySlot.end(); ++it)
+    {
+        if (it->second.inventoryItemId == inventoryItemId)
+        {
+            applyItem(*state, *state->derivedFrom, it->second, -1);
+            state->equippedBySlot.erase(it);
+            return;
+        }
+    }
+}
+
+void
+CharacterAttributeService::setItemDurability(int characterId, int inventoryItemId, int durabilityCurrent)
+{
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    auto *state = findState(characterId);
+    if (!state)
+        return;
+    for (auto &[slot, item] : state->equippedBySlot)
+    {
+        if (item.inventoryItemId != inventoryItemId)
+            continue;
+        applyItem(*state, *state->derivedFrom, item, -1);
+        item.durabilityCurrent = durabilityCurrent;
+        applyItem(*state, *state->derivedFrom, item, +1);
+        return;
+    }
+}
+
+void
+CharacterAttributeService::forgetInventoryItem(int inventoryItemId)
+{
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    for (auto it = states_.begin(); it != states_.end();)
+    {
+        const auto &equipped = it->second.equippedBySlot;
+        const bool holdsItem = std::any_of(equipped.begin(), equipped.end(), [inventoryItemId](const auto &entry)
+            { return entry.second.inventoryItemId == inventoryItemId; });
+        it = holdsItem ? states_.erase(it) : std::next(it);
+    }
+}
+
+bool
+CharacterAttributeService::isCached(int characterId)
+{
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    return states_.find(characterId) != states_.end();
+}
+
+void
+CharacterAttributeService::forgetCharacter(int characterId)
+{
+    std::lock_guard<std::mutex> lock(statesMutex_);
+    states_.erase(characterId);
+}
@@ -1,15 +1,170 @@
 #include "services/CharacterManager.hpp"
 #include "utils/Database.hpp"
+#include "utils/LogMacros.hpp"
+#include <algorithm>
 #include <cstdint>
+#include <initializer_list>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
 #include <random>
 #include <spdlog/logger.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
-CharacterManager::CharacterManager(Logger &logger)
-    : logger_(logger)
+namespace
+{
+// Keeps the last snapshot entry per character; ON CONFLICT cannot touch the same row twice in one statement.
+std::vector<const CharacterDataStruct *>
+lastEntryPerCharacter(const std::vector<CharacterDataStruct> &characters)
+{
+    std::unordered_map<int, size_t> indexById;
+    std::vector<const CharacterDataStruct *> unique;
+    indexById.reserve(characters.size());
+    unique.reserve(characters.size());
+    for (const auto &c : characters)
+    {
+        if (c.characterId <= 0)
+            continue;
+        auto [it, inserted] = indexById.emplace(c.characterId, unique.size());
+        if (inserted)
+            unique.push_back(&c);
+        else
+            unique[it->second] = &c;
+    }
+    return unique;
+}
+
+void
+readBasicCharacterRow(const pqxx::row &row, CharacterDataStruct &characterData)
+{
+    characterData.characterId = row[0].as<int>();
+    characterData.characterLevel = row[1].as<int>();
+    characterData.characterName = row[2].as<std::string>();
+    characterData.characterClass = row[3].as<std::string>();
+    characterData.characterRace = row[4].as<std::string>();
+    characterData.characterExperiencePoints = row[5].as<int>();
+    characterData.characterCurrentHealth = row[6].as<int>();
+    characterData.characterCurrentMana = row[7].as<int>();
+    characterData.classId = row["class_id"].as<int>();
+    characterData.experienceDebt = row["experience_debt"].as<int>(0);
+    characterData.freeSkillPoints = row["free_skill_points"].as<int>(0);
+    characterData.characterGender = row["gender_slug"].is_null() ? "" : row["gender_slug"].as<std::string>();
+    characterData.totalPlayTimeSec = row["total_play_time_sec"].as<int64_t>(0);
+    characterData.lastSessionPlayTimeSec = row["last_session_play_time_sec"].as<int64_t>(0);
+}
+
+PositionStruct
+readPosition(const pqxx::result &result)
+{
+    PositionStruct pos;
+    if (!result.empty())
+    {
+        pos.positionX = result[0][0].as<float>();
+        pos.positionY = result[0][1].as<float>();
+        pos.positionZ = result[0][2].as<float>();
+        pos.rotationZ = result[0][3].as<float>(0.0f);
+    }
+    return pos;
+}
+
+std::vector<SkillStruct>
+readSkills(const pqxx::result &result)
+{
+    std::vector<SkillStruct> skills;
+    skills.reserve(result.size());
+    for (const auto &row : result)
+    {
+        SkillStruct skill;
+        skill.skillName = row["skill_name"].as<std::string>();
+        skill.skillSlug = row["skill_slug"].as<std::string>();
+        skill.scaleStat = row["scale_stat"].as<std::string>();
+        skill.school = row["school"].as<std::string>();
+        skill.skillEffectType = row["skill_effect_type"].as<std::string>();
+        skill.skillLevel = row["skill_level"].as<int>();
+        skill.coeff = row["coeff"].as<float>();
+        skill.flatAdd = row["flat_add"].as<float>();
+        skill.cooldownMs = row["cooldown_ms"].as<int>();
+        skill.gcdMs = row["gcd_ms"].as<int>();
+        skill.castMs = row["cast_ms"].as<int>();
+        skill.costMp = row["cost_mp"].as<int>();
+        skill.maxRange = row["max_range"].as<float>();
+        skill.areaRadius = row["area_radius"].as<float>();
+        skill.swingMs = row["swing_ms"].as<int>();
+        skill.animationName = row["animation_name"].as<std::string>();
+        skill.isPassive = row["is_passive"].as<bool>(false);
+
+        // Parse active effects (buff/heal/dot/hot effects for non-passive active skills)
+        if (!row["active_effects"].is_null())
+        {
+            try
+            {
+                auto effsArr = nlohmann::json::parse(row["active_effects"].as<std::string>());
+                for (const auto &eff : effsArr)
+                {
+                    SkillEffectDefinitionStruct ed;
+                    ed.effectSlug      = eff.value("effectSlug",      "");
+                    ed.effectTypeSlug  = eff.value("effectTypeSlug",  "");
+                    ed.attributeSlug   = eff.value("attributeSlug",   "");
+                    ed.value           = eff.value("value",           0.0f);
+                    ed.durationSeconds = eff.value("durationSeconds", 0);
+                    ed.tickMs          = eff.value("tickMs",          0);
+                    if (!ed.effectSlug.empty())
+                        skill.effects.push_back(std::move(ed));
+                }
+            }
+            catch (const std::exception &)
+            {
+                // JSON parse failure — skip effects for this skill
+            }
+        }
+
+        skills.push_back(std::move(skill));
+    }
+    return skills;
+}
+
+std::vector<SkillBarSlotStruct>
+readSkillBar(const pqxx::result &result)
+{
+    std::vector<SkillBarSlotStruct> slots;
+    slots.reserve(result.size());
+    for (const auto &row : result)
+    {
+        SkillBarSlotStruct slot;
+        slot.slotIndex = row["slot_index"].as<int>();
+        slot.skillSlug = row["skill_slug"].as<std::string>();
+        slots.push_back(slot);
+    }
+    return slots;
+}
+
+// "EXECUTE name(1, 2)": runs a statement prepared on the connection from plain query text,
+// which is all pqxx::pipeline accepts. Integer arguments need no quoting. The statement must
+// already exist on the server; Database::prepareDefaultQueries() prepares these eagerly.
+std::string
+executeStatement(const char *preparedName, std::initializer_list<int> args)
+{
+    std::string sql = "EXECUTE ";
+    sql += preparedName;
+    sql += '(';
+    bool first = true;
+    for (int arg : args)
+    {
+        if (!first)
+            sql += ", ";
+        sql += std::to_string(arg);
+        first = false;
+    }
+    sql += ')';
+    return sql;
+}
+} // namespace
+
+CharacterManager::CharacterManager(Logger &logger, CharacterAttributeService &attributeService)
+    : logger_(logger),
+      attributeService_(attributeService)
 {
     log_ = logger.getSystem("character");
 }
@@ -58,11 +213,57 @@ CharacterManager::hasCharacter(int characterId)
 CharacterDataStruct
 CharacterManager::loadCharacterFromDatabase(Database &db, int accountId, int characterId)
 {
-    CharacterDataStruct character = getBasicCharacterDataFromDatabase(db, accountId, characterId);
-    character.characterPosition = getCharacterPositionFromDatabase(db, accountId, characterId);
-    character.attributes = getCharacterAttributesFromDatabase(db, characterId);
-    character.skills = getCharacterSkillsFromDatabase(db, characterId);
-    character.skillBarSlots = getCharacterSkillBarFromDatabase(db, characterId);
+    // Anything still pending in the write-behind cache must reach the table before it is read back
+    flushCharacter(db, characterId);
+
+    // One connection, one transaction, and all seven queries sent as a single pipelined
+    // batch, instead of a pooled connection and round trip per part of the character.
+    CharacterDataStruct character;
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        pqxx::work txn(_dbConn.get());
+        pqxx::pipeline pipe(txn);
+        pipe.retain(7);
+
+        const auto basicQuery = pipe.insert(executeStatement("get_character", {accountId, characterId}));
+        const auto expQuery = pipe.insert(executeStatement("get_character_exp_for_next_level_by_character", {characterId}));
+        const auto positionQuery = pipe.insert(executeStatement("get_character_position", {characterId}));
+        const auto equipmentQuery = pipe.insert(executeStatement("get_character_equipment_stats", {characterId}));
+        const auto modifiersQuery = pipe.insert(executeStatement("get_character_permanent_modifiers", {characterId}));
+        const auto skillsQuery = pipe.insert(executeStatement("get_character_skills", {characterId}));
+        const auto skillBarQuery = pipe.insert(executeStatement("get_character_skill_bar", {characterId}));
+        pipe.complete();
+
+        const auto basic = pipe.retrieve(basicQuery);
+        const auto exp = pipe.retrieve(expQuery);
+        const auto position = pipe.retrieve(positionQuery);
+        const auto equipment = pipe.retrieve(equipmentQuery);
+        const auto modifiers = pipe.retrieve(modifiersQuery);
+        const auto skills = pipe.retrieve(skillsQuery);
+        const auto skillBar = pipe.retrieve(skillBarQuery);
+        txn.commit();
+
+        // get_character also checks ownership; the per-character parts are only used when it matched
+        if (basic.empty())
+        {
+            log_->warn("Character {} not found for account {}", characterId, accountId);
+            return character;
+        }
+        readBasicCharacterRow(basic[0], character);
+        character.expForNextLevel = exp.empty() ? 0 : exp[0][0].as<int>();
+        character.characterPosition = readPosition(position);
+        attributeService_.setCharacterInputs(characterId, character.classId, character.characterLevel, equipment, modifiers);
+        character.attributes = attributeService_.getAttributes(db, characterId);
+        character.skills = readSkills(skills);
+        character.skillBarSlots = readSkillBar(skillBar);
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+        return CharacterDataStruct();
+    }
+
     addOrUpdateCharacter(character);
     return character;
 }
@@ -85,24 +286,10 @@ CharacterManager::getBasicCharacterDataFromDatabase(Database &db, int accountId,
         auto result = db.executeQueryWithTransaction(txn, "get_character", {accountId, characterId});
         if (!result.empty())
         {
-            const auto &row = result[0];
-            characterData.characterId = row[0].as<int>();
-            characterData.characterLevel = row[1].as<int>();
-            characterData.characterName = row[2].as<std::string>();
-            characterData.characterClass = row[3].as<std::string>();
-            characterData.characterRace = row[4].as<std::string>();
-            characterData.characterExperiencePoints = row[5].as<int>();
-            characterData.characterCurrentHealth = row[6].as<int>();
-            characterData.characterCurrentMana = row[7].as<int>();
-            characterData.classId = row["class_id"].as<int>();
-            characterData.experienceDebt = row["experience_debt"].as<int>(0);
-            characterData.freeSkillPoints = row["free_skill_points"].as<int>(0);
-            characterData.characterGender = row["gender_slug"].is_null() ? "" : row["gender_slug"].as<std::string>();
-            characterData.totalPlayTimeSec = row["total_play_time_sec"].as<int64_t>(0);
-            characterData.lastSessionPlayTimeSec = row["last_session_play_time_sec"].as<int64_t>(0);
+            readBasicCharacterRow(result[0], characterData);
 
             auto expResult = db.executeQueryWithTransaction(txn, "get_character_exp_for_next_level", {characterData.characterLevel});
-            characterData.expForNextLevel = expResult[0][0].as<int>();
+            characterData.expForNextLevel = expResult.empty() ? 0 : expResult[0][0].as<int>();
         }
         txn.commit();
     }
@@ -121,14 +308,7 @@ CharacterManager::getCharacterPositionFromDatabase(Database &db, int accountId,
     {
         auto _dbConn = db.getConnectionLocked();
         pqxx::work txn(_dbConn.get());
-        auto result = db.executeQueryWithTransaction(txn, "get_character_position", {characterId});
-        if (!result.empty())
-        {
-            pos.positionX = result[0][0].as<float>();
-            pos.positionY = result[0][1].as<float>();
-            pos.positionZ = result[0][2].as<float>();
-            pos.rotationZ = result[0][3].as<float>(0.0f);
-        }
+        pos = readPosition(db.executeQueryWithTransaction(txn, "get_character_position", {characterId}));
         txn.commit();
     }
     catch (const std::exception &e)
@@ -141,28 +321,7 @@ CharacterManager::getCharacterPositionFromDatabase(Database &db, int accountId,
 std::vector<CharacterAttributeStruct>
 CharacterManager::getCharacterAttributesFromDatabase(Database &db, int characterId)
 {
-    std::vector<CharacterAttributeStruct> attributes;
-    try
-    {
-        auto _dbConn = db.getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-        auto result = db.executeQueryWithTransaction(txn, "get_character_attributes", {characterId});
-        for (const auto &row : result)
-        {
-            CharacterAttributeStruct attr;
-            attr.id = row["id"].as<int>();
-            attr.name = row["name"].as<std::string>();
-            attr.slug = row["slug"].as<std::string>();
-            attr.value = row["value"].as<int>();
-            attributes.push_back(attr);
-        }
-        txn.commit();
-    }
-    catch (const std::exception &e)
-    {
-        db.handleDatabaseError(e);
-    }
-    return attributes;
+    return attributeService_.getAttributes(db, characterId);
 }
 
 std::vector<SkillStruct>
@@ -171,62 +330,11 @@ CharacterManager::getCharacterSkillsFromDatabase(Database &db, int characterId)
     std::vector<SkillStruct> skills;
     try
     {
-        // debug
-        log_->debug("Fetching character skills from database");
-        log_->debug("Character ID: " + std::to_string(characterId));
+        GS_LOG_DEBUG(log_, "Fetching character skills from database for character ID: {}", characterId);
 
         auto _dbConn = db.getConnectionLocked();
-
         pqxx::work txn(_dbConn.get());
-        auto result = db.executeQueryWithTransaction(txn, "get_character_skills", {characterId});
-        for (const auto &row : result)
-        {
-            SkillStruct skill;
-            skill.skillName = row["skill_name"].as<std::string>();
-            skill.skillSlug = row["skill_slug"].as<std::string>();
-            skill.scaleStat = row["scale_stat"].as<std::string>();
-            skill.school = row["school"].as<std::string>();
-            skill.skillEffectType = row["skill_effect_type"].as<std::string>();
-            skill.skillLevel = row["skill_level"].as<int>();
-            skill.coeff = row["coeff"].as<float>();
-            skill.flatAdd = row["flat_add"].as<float>();
-            skill.cooldownMs = row["cooldown_ms"].as<int>();
-            skill.gcdMs = row["gcd_ms"].as<int>();
-            skill.castMs = row["cast_ms"].as<int>();
-            skill.costMp = row["cost_mp"].as<int>();
-            skill.maxRange = row["max_range"].as<float>();
-            skill.areaRadius = row["area_radius"].as<float>();
-            skill.swingMs = row["swing_ms"].as<int>();
-            skill.animationName = row["animation_name"].as<std::string>();
-            skill.isPassive = row["is_passive"].as<bool>(false);
-
-            // Parse active effects (buff/heal/dot/hot effects for non-passive active skills)
-            if (!row["active_effects"].is_null())
-            {
-                try
-                {
-                    auto effsArr = nlohmann::json::parse(row["active_effects"].as<std::string>());
-                    for (const auto &eff : effsArr)
-                    {
-                        SkillEffectDefinitionStruct ed;
-                        ed.effectSlug      = eff.value("effectSlug",      "");
-                        ed.effectTypeSlug  = eff.value("effectTypeSlug",  "");
-                        ed.attributeSlug   = eff.value("attributeSlug",   "");
-                        ed.value           = eff.value("value",           0.0f);
-                        ed.durationSeconds = eff.value("durationSeconds", 0);
-                        ed.tickMs          = eff.value("tickMs",          0);
-                        if (!ed.effectSlug.empty())
-                            skill.effects.push_back(std::move(ed));
-                    }
-                }
-                catch (const std::exception &)
-                {
-                    // JSON parse failure — skip effects for this skill
-                }
-            }
-
-            skills.push_back(skill);
-        }
+        skills = readSkills(db.executeQueryWithTransaction(txn, "get_character_skills", {characterId}));
         txn.commit();
     }
     catch (const std::exception &e)
@@ -244,14 +352,7 @@ CharacterManager::getCharacterSkillBarFromDatabase(Database &db, int characterId
     {
         auto _dbConn = db.getConnectionLocked();
         pqxx::work txn(_dbConn.get());
-        auto result = db.executeQueryWithTransaction(txn, "get_character_skill_bar", {characterId});
-        for (const auto &row : result)
-        {
-            SkillBarSlotStruct slot;
-            slot.slotIndex = row["slot_index"].as<int>();
-            slot.skillSlug = row["skill_slug"].as<std::string>();
-            slots.push_back(slot);
-        }
+        slots = readSkillBar(db.executeQueryWithTransaction(txn, "get_character_skill_bar", {characterId}));
         txn.commit();
     }
     catch (const std::exception &e)
@@ -261,45 +362,6 @@ CharacterManager::getCharacterSkillBarFromDatabase(Database &db, int characterId
     return slots;
 }
 
-std::vector<SkillStruct>
-CharacterManager::getMobSkillsFromDatabase(Database &db, int mobId)
-{
-    std::vector<SkillStruct> skills;
-    try
-    {
-        auto _dbConn = db.getConnectionLocked();
-        pqxx::work txn(_dbConn.get());
-        auto result = db.executeQueryWithTransaction(txn, "get_mob_skills", {mobId});
-        for (const auto &row : result)
-        {
-            SkillStruct skill;
-            skill.skillName = row["skill_name"].as<std::string>();
-            skill.skillSlug = row["skill_slug"].as<std::string>();
-            skill.scaleStat = row["scale_stat"].as<std::string>();
-            skill.school = row["school"].as<std::string>();
-            skill.skillEffectType = row["skill_effect_type"].as<std::string>();
-            skill.skillLevel = row["skill_level"].as<int>();
-            skill.coeff = row["coeff"].as<float>();
-            skill.flatAdd = row["flat_add"].as<float>();
-            skill.cooldownMs = row["cooldown_ms"].as<int>();
-            skill.gcdMs = row["gcd_ms"].as<int>();
-            skill.castMs = row["cast_ms"].as<int>();
-            skill.costMp = row["cost_mp"].as<int>();
-            skill.maxRange = row["max_range"].as<float>();
-            skill.areaRadius = row["area_radius"].as<float>();
-            skill.swingMs = row["swing_ms"].as<int>();
-            skill.animationName = row["animation_name"].as<std::string>();
-            skills.push_back(skill);
-        }
-        txn.commit();
-    }
-    catch (const std::exception &e)
-    {
-        db.handleDatabaseError(e);
-    }
-    return skills;
-}
-
 void
 CharacterManager::updateCharacterPositionInMemory(int accountId, int characterId, const PositionStruct &position)
 {
@@ -329,6 +391,13 @@ CharacterManager::updateCharacterPosition(Database &db, int accountId, int chara
 void
 CharacterManager::updateBasicCharacterData(Database &db, int accountId, int characterId, const CharacterDataStruct &characterData)
 {
+    // Direct writes to level/exp must not be overtaken by an older pending value. If the
+    // pending state had to be put back, these values replace it there as well.
+    if (!flushCharacter(db, characterId))
+    {
+        markExperienceDirty(characterId, characterData.characterExperiencePoints, characterData.characterLevel);
+        markHpManaDirty(characterId, characterData.characterCurrentHealth, characterData.characterCurrentMana);
+    }
     try
     {
         auto _dbConn = db.getConnectionLocked();
@@ -347,6 +416,9 @@ CharacterManager::updateBasicCharacterData(Database &db, int accountId, int char
 void
 CharacterManager::updateCharacterExperienceAndLevel(Database &db, int characterId, int experiencePoints, int level)
 {
+    // Same ordering as updateBasicCharacterData
+    if (!flushCharacter(db, characterId))
+        markExperienceDirty(characterId, experiencePoints, level);
     try
     {
         auto _dbConn = db.getConnectionLocked();
@@ -359,6 +431,7 @@ CharacterManager::updateCharacterExperienceAndLevel(Database &db, int characterI
             GREEN);
 
         // Keep in-memory state in sync
+        attributeService_.setLevel(characterId, level);
         std::unique_lock lock(mutex_);
         auto it = charactersMap_.find(characterId);
         if (it != charactersMap_.end())
@@ -390,9 +463,93 @@ CharacterManager::saveCharacterHpMana(Database &db, int characterId, int current
     }
 }
 
+int
+CharacterManager::saveCharacterPositionsBulk(Database &db, const std::vector<CharacterDataStruct> &characters)
+{
+    const auto unique = lastEntryPerCharacter(characters);
+    if (unique.empty())
+        return 0;
+
+    std::vector<int> ids;
+    std::vector<float> xs, ys, zs, rots;
+    ids.reserve(unique.size());
+    xs.reserve(unique.size());
+    ys.reserve(unique.size());
+    zs.reserve(unique.size());
+    rots.reserve(unique.size());
+    for (const auto *c : unique)
+    {
+        ids.push_back(c->characterId);
+        xs.push_back(c->characterPosition.positionX);
+        ys.push_back(c->characterPosition.positionY);
+        zs.push_back(c->characterPosition.positionZ);
+        rots.push_back(c->characterPosition.rotationZ);
+    }
+
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        pqxx::work txn(_dbConn.get());
+        auto result = db.executeQueryWithTransaction(txn, "set_character_positions_bulk",
+            {toPgArrayLiteral(ids), toPgArrayLiteral(xs), toPgArrayLiteral(ys), toPgArrayLiteral(zs), toPgArrayLiteral(rots)});
+        const int updated = static_cast<int>(result.affected_rows());
+        txn.commit();
+        return updated;
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+    }
+    return 0;
+}
+
+int
+CharacterManager::saveCharacterHpManaBulk(Database &db, const std::vector<CharacterDataStruct> &characters)
+{
+    const auto unique = lastEntryPerCharacter(characters);
+    if (unique.empty())
+        return 0;
+
+    std::vector<int> ids, hps, manas;
+    ids.reserve(unique.size());
+    hps.reserve(unique.size());
+    manas.reserve(unique.size());
+    for (const auto *c : unique)
+    {
+        ids.push_back(c->characterId);
+        hps.push_back(c->characterCurrentHealth);
+        manas.push_back(c->characterCurrentMana);
+    }
+
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        pqxx::work txn(_dbConn.get());
+        auto result = db.executeQueryWithTransaction(txn, "upsert_character_current_state_bulk",
+            {toPgArrayLiteral(ids), toPgArrayLiteral(hps), toPgArrayLiteral(manas)});
+        const int written = static_cast<int>(result.affected_rows());
+        txn.commit();
+        return written;
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+    }
+    return 0;
+}
+
 void
 CharacterManager::setCharacterOnline(Database &db, int characterId)
 {
+    // Waits out a flush in progress, so a failed disconnect write is back in pending_ and gets marked below
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        auto it = pending_.find(characterId);
+        if (it != pending_.end() && it->second.disconnected)
+            it->second.reconnected = true;
+    }
+
     try
     {
         auto _dbConn = db.getConnectionLocked();
@@ -440,3 +597,372 @@ CharacterManager::resetAllOnline(Database &db)
         db.handleDatabaseError(e);
     }
 }
+
+CharacterManager::PendingCharacterState &
+CharacterManager::pendingEntry(int characterId, DirtyField field)
+{
+    auto [it, inserted] = pending_.try_emplace(characterId);
+    auto &entry = it->second;
+    if (inserted)
+        entry.dirtySince = std::chrono::steady_clock::now();
+    else if (entry.dirty & field)
+        ++writeBehindStats_.updatesMerged;
+    entry.dirty |= field;
+    return entry;
+}
+
+void
+CharacterManager::markPositionDirty(int characterId, const PositionStruct &position)
+{
+    if (characterId <= 0)
+        return;
+    updateCharacterPositionInMemory(0, characterId, position);
+
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntry(characterId, DirtyPosition).position = position;
+}
+
+void
+CharacterManager::markHpManaDirty(int characterId, int currentHp, int currentMana)
+{
+    if (characterId <= 0)
+        return;
+    {
+        std::unique_lock lock(mutex_);
+        auto it = charactersMap_.find(characterId);
+        if (it != charactersMap_.end())
+        {
+            it->second.characterCurrentHealth = currentHp;
+            it->second.characterCurrentMana = currentMana;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto &entry = pendingEntry(characterId, DirtyHpMana);
+    entry.currentHp = currentHp;
+    entry.currentMana = currentMana;
+}
+
+void
+CharacterManager::markExperienceDirty(int characterId, int experiencePoints, int level)
+{
+    if (characterId <= 0)
+        return;
+    {
+        std::unique_lock lock(mutex_);
+        auto it = charactersMap_.find(characterId);
+        if (it != charactersMap_.end())
+        {
+            it->second.characterExperiencePoints = experiencePoints;
+            it->second.characterLevel = level;
+        }
+    }
+
+    attributeService_.setLevel(characterId, level);
+
+    // set_character_exp_level grants skill points from the stored level, so writing only
+    // the latest level still grants the points for every level gained in between
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto &entry = pendingEntry(characterId, DirtyExperience);
+    entry.experiencePoints = experiencePoints;
+    entry.level = level;
+}
+
+void
+CharacterManager::markExperienceDebtDirty(int characterId, int experienceDebt)
+{
+    if (characterId <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntry(characterId, DirtyExperienceDebt).experienceDebt = experienceDebt;
+}
+
+void
+CharacterManager::markPlayTimeDirty(int characterId, int64_t sessionPlayTimeSec, int64_t lastSessionPlayTimeSec, bool isDisconnect)
+{
+    if (characterId <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto &entry = pendingEntry(characterId, DirtyPlayTime);
+    entry.playTimeSec += sessionPlayTimeSec;
+    if (isDisconnect)
+    {
+        entry.disconnected = true;
+        entry.reconnected = false;
+        entry.lastSessionPlayTimeSec = lastSessionPlayTimeSec;
+    }
+}
+
+CharacterManager::WriteResult
+CharacterManager::writePending(Database &db, const PendingMap &batch)
+{
+    std::vector<int> positionIds, hpManaIds, hps, manas, expIds, exps, levels, debtIds, debts, playTimeIds;
+    std::vector<float> xs, ys, zs, rots;
+    std::vector<int64_t> playTimes;
+    std::vector<const std::pair<const int, PendingCharacterState> *> disconnects;
+
+    for (const auto &item : batch)
+    {
+        const int characterId = item.first;
+        const auto &entry = item.second;
+        if (entry.dirty & DirtyPosition)
+        {
+            positionIds.push_back(characterId);
+            xs.push_back(entry.position.positionX);
+            ys.push_back(entry.position.positionY);
+            zs.push_back(entry.position.positionZ);
+            rots.push_back(entry.position.rotationZ);
+        }
+        if (entry.dirty & DirtyHpMana)
+        {
+            hpManaIds.push_back(characterId);
+            hps.push_back(entry.currentHp);
+            manas.push_back(entry.currentMana);
+        }
+        if (entry.dirty & DirtyExperience)
+        {
+            expIds.push_back(characterId);
+            exps.push_back(entry.experiencePoints);
+            levels.push_back(entry.level);
+        }
+        if (entry.dirty & DirtyExperienceDebt)
+        {
+            debtIds.push_back(characterId);
+            debts.push_back(entry.experienceDebt);
+        }
+        if (entry.dirty & DirtyPlayTime)
+        {
+            if (entry.disconnected)
+            {
+                disconnects.push_back(&item);
+            }
+            else if (entry.playTimeSec != 0)
+            {
+                playTimeIds.push_back(characterId);
+                playTimes.push_back(entry.playTimeSec);
+            }
+        }
+    }
+
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        try
+        {
+            // executeQueryWithTransaction aborts the transaction on error, which makes the
+            // following statement or the commit throw.
+            pqxx::work txn(_dbConn.get());
+            if (!positionIds.empty())
+                db.executeQueryWithTransaction(txn, "set_character_positions_bulk",
+                    {toPgArrayLiteral(positionIds), toPgArrayLiteral(xs), toPgArrayLiteral(ys), toPgArrayLiteral(zs), toPgArrayLiteral(rots)});
+            if (!hpManaIds.empty())
+                db.executeQueryWithTransaction(txn, "upsert_character_current_state_bulk",
+                    {toPgArrayLiteral(hpManaIds), toPgArrayLiteral(hps), toPgArrayLiteral(manas)});
+            if (!expIds.empty())
+                db.executeQueryWithTransaction(txn, "set_character_exp_level_bulk",
+                    {toPgArrayLiteral(expIds), toPgArrayLiteral(exps), toPgArrayLiteral(levels)});
+            if (!debtIds.empty())
+                db.executeQueryWithTransaction(txn, "set_character_experience_debt_bulk",
+                    {toPgArrayLiteral(debtIds), toPgArrayLiteral(debts)});
+            if (!playTimeIds.empty())
+                db.executeQueryWithTransaction(txn, "add_character_playtime_bulk",
+                    {toPgArrayLiteral(playTimeIds), toPgArrayLiteral(playTimes)});
+            for (const auto *item : disconnects)
+            {
+                db.executeQueryWithTransaction(txn, "save_character_playtime_disconnect",
+                    {item->first, item->second.playTimeSec, item->second.lastSessionPlayTimeSec});
+                if (item->second.reconnected)
+                    db.executeQueryWithTransaction(txn, "set_character_online", {item->first});
+            }
+            txn.commit();
+            return WriteResult::Written;
+        }
+        catch (const std::exception &e)
+        {
+            db.handleDatabaseError(e);
+            // With the connection still up the database refused something in the batch
+            // (a constraint, a character deleted meanwhile) and retrying it unchanged will
+            // fail the same way; a lost connection is worth retrying
+            return _dbConn.get().is_open() ? WriteResult::Rejected : WriteResult::Failed;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+    }
+    return WriteResult::Failed;
+}
+
+CharacterManager::FlushOutcome
+CharacterManager::flushBatch(Database &db, PendingMap &&batch)
+{
+    const auto started = std::chrono::steady_clock::now();
+    FlushOutcome outcome;
+    PendingMap written, failed;
+    const WriteResult result = writePending(db, batch);
+    if (result == WriteResult::Written)
+    {
+        written.swap(batch);
+    }
+    else if (result == WriteResult::Failed)
+    {
+        failed.swap(batch);
+    }
+    else
+    {
+        // The database refused the batch: write each character alone, so a single bad row
+        // only costs its own character instead of holding everyone back on every flush
+        const bool single = batch.size() == 1;
+        while (!batch.empty())
+        {
+            PendingMap one;
+            one.insert(batch.extract(batch.begin()));
+            const WriteResult alone = single ? result : writePending(db, one);
+            if (alone == WriteResult::Written)
+            {
+                written.merge(one);
+                continue;
+            }
+            if (alone == WriteResult::Failed)
+            {
+                // Lost the connection part way through; what is left goes out next time
+                failed.merge(one);
+                failed.merge(batch);
+                break;
+            }
+            const auto &[characterId, entry] = *one.begin();
+            log_->error("Write-behind: dropping pending state of character {} that the database keeps rejecting "
+                        "(fields 0x{:x}: position {},{},{},{} hp/mana {}/{} exp {} level {} debt {} play time +{}s{})",
+                characterId, entry.dirty, entry.position.positionX, entry.position.positionY, entry.position.positionZ,
+                entry.position.rotationZ, entry.currentHp, entry.currentMana, entry.experiencePoints, entry.level,
+                entry.experienceDebt, entry.playTimeSec, entry.disconnected ? ", disconnect" : "");
+            ++outcome.quarantined;
+        }
+    }
+
+    outcome.written = static_cast<int>(written.size());
+    outcome.requeued = static_cast<int>(failed.size());
+    finishFlush(std::move(written), std::move(failed), outcome.quarantined, started);
+    return outcome;
+}
+
+void
+CharacterManager::finishFlush(PendingMap &&written, PendingMap &&failedBatch, int quarantined, std::chrono::steady_clock::time_point started)
+{
+    const auto now = std::chrono::steady_clock::now();
+    auto oldest = now;
+    for (const auto &[characterId, entry] : written)
+        oldest = std::min(oldest, entry.dirtySince);
+
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto &stats = writeBehindStats_;
+    ++stats.flushes;
+    stats.lastFlushDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - started).count();
+    stats.charactersFlushed += written.size();
+    stats.charactersQuarantined += quarantined;
+    if (!written.empty())
+        stats.lastFlushLagMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - oldest).count();
+    if (failedBatch.empty())
+        return;
+
+    // Put the failed entries back under anything marked while they were being written;
+    // newer values win, play time deltas add up
+    ++stats.failedFlushes;
+    for (auto &[characterId, failed] : failedBatch)
+    {
+        auto [it, inserted] = pending_.try_emplace(characterId, failed);
+        if (inserted)
+            continue;
+        auto &newer = it->second;
+        const uint8_t missing = failed.dirty & ~newer.dirty;
+        if (missing & DirtyPosition)
+            newer.position = failed.position;
+        if (missing & DirtyHpMana)
+        {
+            newer.currentHp = failed.currentHp;
+            newer.currentMana = failed.currentMana;
+        }
+        if (missing & DirtyExperience)
+        {
+            newer.experiencePoints = failed.experiencePoints;
+            newer.level = failed.level;
+        }
+        if (missing & DirtyExperienceDebt)
+            newer.experienceDebt = failed.experienceDebt;
+        if (failed.dirty & DirtyPlayTime)
+        {
+            newer.playTimeSec += failed.playTimeSec;
+            // The online state recorded later wins; the failed disconnect only fills in
+            // last_session_play_time_sec when nothing newer was recorded
+            if (failed.disconnected && !newer.disconnected)
+            {
+                newer.disconnected = true;
+                newer.reconnected = failed.reconnected;
+                newer.lastSessionPlayTimeSec = failed.lastSessionPlayTimeSec;
+            }
+        }
+        newer.dirty |= failed.dirty;
+        newer.dirtySince = std::min(newer.dirtySince, failed.dirtySince);
+    }
+}
+
+int
+CharacterManager::flushDirtyCharacters(Database &db)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    PendingMap batch;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        batch.swap(pending_);
+    }
+    if (batch.empty())
+        return 0;
+
+    const FlushOutcome outcome = flushBatch(db, std::move(batch));
+    if (outcome.requeued > 0)
+        log_->error("Write-behind flush failed for {} character(s), will retry", outcome.requeued);
+
+    if (outcome.written > 0 && log_->should_log(spdlog::level::debug))
+    {
+        const auto stats = getWriteBehindStats();
+        log_->debug("Write-behind flush: {} character(s) in {} ms, lag {} ms, {} pending, {} updates merged so far",
+            outcome.written, stats.lastFlushDurationMs, stats.lastFlushLagMs, stats.pendingCharacters, stats.updatesMerged);
+    }
+    return outcome.written;
+}
+
+bool
+CharacterManager::flushCharacter(Database &db, int characterId)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    PendingMap batch;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        auto node = pending_.extract(characterId);
+        if (node.empty())
+            return true;
+        batch.insert(std::move(node));
+    }
+
+    const FlushOutcome outcome = flushBatch(db, std::move(batch));
+    if (outcome.requeued > 0)
+        log_->error("Write-behind flush of character {} failed, will retry", characterId);
+    return outcome.requeued == 0;
+}
+
+CharacterManager::WriteBehindStats
+CharacterManager::getWriteBehindStats()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    WriteBehindStats stats = writeBehindStats_;
+    stats.pendingCharacters = pending_.size();
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto &[characterId, entry] : pending_)
+    {
+        for (uint8_t bits = entry.dirty; bits != 0; bits &= bits - 1)
+            ++stats.pendingFields;
+        stats.oldestPendingAgeMs = std::max<int64_t>(stats.oldestPendingAgeMs,
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - entry.dirtySince).count());
+    }
+    return stats;
+}
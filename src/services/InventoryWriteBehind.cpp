@@ -0,0 +1,317 @@
+#include "services/InventoryWriteBehind.hpp"
+#include <algorithm>
+#include <spdlog/logger.h>
+#include <vector>
+
+InventoryWriteBehind::InventoryWriteBehind(Logger &logger)
+{
+    log_ = logger.getSystem("inventory");
+}
+
+InventoryWriteBehind::PendingItemState &
+InventoryWriteBehind::pendingEntry(int characterId, int inventoryItemId, DirtyField field)
+{
+    auto [it, inserted] = pending_.try_emplace(inventoryItemId);
+    auto &entry = it->second;
+    if (inserted)
+    {
+        entry.dirtySince = std::chrono::steady_clock::now();
+        ++pendingPerCharacter_[characterId];
+    }
+    else
+    {
+        if (entry.dirty & field)
+            ++writeBehindStats_.updatesMerged;
+        if (entry.characterId != characterId)
+        {
+            // Ownership changes flush first, so this only happens on a stale event
+            if (--pendingPerCharacter_[entry.characterId] == 0)
+                pendingPerCharacter_.erase(entry.characterId);
+            ++pendingPerCharacter_[characterId];
+        }
+    }
+    entry.characterId = characterId;
+    entry.dirty |= field;
+    return entry;
+}
+
+InventoryWriteBehind::PendingMap::node_type
+InventoryWriteBehind::extractLocked(int inventoryItemId)
+{
+    auto node = pending_.extract(inventoryItemId);
+    if (!node.empty())
+    {
+        auto count = pendingPerCharacter_.find(node.mapped().characterId);
+        if (count != pendingPerCharacter_.end() && --count->second == 0)
+            pendingPerCharacter_.erase(count);
+    }
+    return node;
+}
+
+void
+InventoryWriteBehind::markQuantityDirty(int characterId, int inventoryItemId, int quantity)
+{
+    if (characterId <= 0 || inventoryItemId <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntry(characterId, inventoryItemId, DirtyQuantity).quantity = quantity;
+}
+
+void
+InventoryWriteBehind::markDurabilityDirty(int characterId, int inventoryItemId, int durabilityCurrent)
+{
+    if (characterId <= 0 || inventoryItemId <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntry(characterId, inventoryItemId, DirtyDurability).durabilityCurrent = durabilityCurrent;
+}
+
+void
+InventoryWriteBehind::markKillCountDirty(int characterId, int inventoryItemId, int killCount)
+{
+    if (characterId <= 0 || inventoryItemId <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntry(characterId, inventoryItemId, DirtyKillCount).killCount = killCount;
+}
+
+void
+InventoryWriteBehind::discardItem(int inventoryItemId)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    extractLocked(inventoryItemId);
+}
+
+InventoryWriteBehind::WriteResult
+InventoryWriteBehind::writePending(Database &db, const PendingMap &batch)
+{
+    std::vector<int> quantityIds, quantityOwners, quantities;
+    std::vector<int> durabilityIds, durabilityOwners, durabilities;
+    std::vector<int> killCountIds, killCountOwners, killCounts;
+
+    for (const auto &[inventoryItemId, entry] : batch)
+    {
+        if (entry.dirty & DirtyQuantity)
+        {
+            quantityIds.push_back(inventoryItemId);
+            quantityOwners.push_back(entry.characterId);
+            quantities.push_back(entry.quantity);
+        }
+        if (entry.dirty & DirtyDurability)
+        {
+            durabilityIds.push_back(inventoryItemId);
+            durabilityOwners.push_back(entry.characterId);
+            durabilities.push_back(entry.durabilityCurrent);
+        }
+        if (entry.dirty & DirtyKillCount)
+        {
+            killCountIds.push_back(inventoryItemId);
+            killCountOwners.push_back(entry.characterId);
+            killCounts.push_back(entry.killCount);
+        }
+    }
+
+    try
+    {
+        auto _dbConn = db.getConnectionLocked();
+        try
+        {
+            // executeQueryWithTransaction aborts the transaction on error, which makes the
+            // following statement or the commit throw.
+            pqxx::work txn(_dbConn.get());
+            if (!quantityIds.empty())
+                db.executeQueryWithTransaction(txn, "update_player_inventory_quantity_bulk",
+                    {toPgArrayLiteral(quantityIds), toPgArrayLiteral(quantityOwners), toPgArrayLiteral(quantities)});
+            if (!durabilityIds.empty())
+                db.executeQueryWithTransaction(txn, "update_durability_current_bulk",
+                    {toPgArrayLiteral(durabilityIds), toPgArrayLiteral(durabilityOwners), toPgArrayLiteral(durabilities)});
+            if (!killCountIds.empty())
+                db.executeQueryWithTransaction(txn, "update_item_kill_count_bulk",
+                    {toPgArrayLiteral(killCountIds), toPgArrayLiteral(killCountOwners), toPgArrayLiteral(killCounts)});
+            txn.commit();
+            return WriteResult::Written;
+        }
+        catch (const std::exception &e)
+        {
+            db.handleDatabaseError(e);
+            // Connection still up: the database refused something in the batch
+            return _dbConn.get().is_open() ? WriteResult::Rejected : WriteResult::Failed;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        db.handleDatabaseError(e);
+    }
+    return WriteResult::Failed;
+}
+
+void
+InventoryWriteBehind::finishFlush(PendingMap &&written, PendingMap &&failedBatch, int quarantined, std::chrono::steady_clock::time_point started)
+{
+    const auto now = std::chrono::steady_clock::now();
+    auto oldest = now;
+    for (const auto &[inventoryItemId, entry] : written)
+        oldest = std::min(oldest, entry.dirtySince);
+
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    auto &stats = writeBehindStats_;
+    ++stats.flushes;
+    stats.lastFlushDurationMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - started).count();
+    stats.itemsFlushed += written.size();
+    stats.itemsQuarantined += quarantined;
+    if (!written.empty())
+        stats.lastFlushLagMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - oldest).count();
+    if (failedBatch.empty())
+        return;
+
+    // Put the failed entries back under anything marked while they were being written;
+    // newer values win
+    ++stats.failedFlushes;
+    for (auto &[inventoryItemId, failed] : failedBatch)
+    {
+        auto [it, inserted] = pending_.try_emplace(inventoryItemId, failed);
+        if (inserted)
+        {
+            ++pendingPerCharacter_[failed.characterId];
+            continue;
+        }
+        auto &newer = it->second;
+        const uint8_t missing = failed.dirty & ~newer.dirty;
+        if (missing & DirtyQuantity)
+            newer.quantity = failed.quantity;
+        if (missing & DirtyDurability)
+            newer.durabilityCurrent = failed.durabilityCurrent;
+        if (missing & DirtyKillCount)
+            newer.killCount = failed.killCount;
+        newer.dirty |= failed.dirty;
+        newer.dirtySince = std::min(newer.dirtySince, failed.dirtySince);
+    }
+}
+
+InventoryWriteBehind::FlushOutcome
+InventoryWriteBehind::flushBatch(Database &db, PendingMap &&batch)
+{
+    const auto started = std::chrono::steady_clock::now();
+    FlushOutcome outcome;
+    PendingMap written, failed;
+    const WriteResult result = writePending(db, batch);
+    if (result == WriteResult::Written)
+    {
+        written.swap(batch);
+    }
+    else if (result == WriteResult::Failed)
+    {
+        failed.swap(batch);
+    }
+    else
+    {
+        // The database refused the batch: write each item alone, so one bad row is not
+        // retried together with everything else on every flush
+        const bool single = batch.size() == 1;
+        while (!batch.empty())
+        {
+            PendingMap one;
+            one.insert(batch.extract(batch.begin()));
+            const WriteResult alone = single ? result : writePending(db, one);
+            if (alone == WriteResult::Written)
+            {
+                written.merge(one);
+                continue;
+            }
+            if (alone == WriteResult::Failed)
+            {
+                failed.merge(one);
+                failed.merge(batch);
+                break;
+            }
+            const auto &[inventoryItemId, entry] = *one.begin();
+            log_->error("Inventory write-behind: dropping pending updates of invItem={} (char={}) that the database keeps "
+                        "rejecting (fields 0x{:x}: quantity {} durability {} kill count {})",
+                inventoryItemId, entry.characterId, entry.dirty, entry.quantity, entry.durabilityCurrent, entry.killCount);
+            ++outcome.quarantined;
+        }
+    }
+
+    if (!failed.empty())
+        log_->error("Inventory write-behind flush failed for {} item(s), will retry", failed.size());
+    outcome.written = static_cast<int>(written.size());
+    outcome.requeued = static_cast<int>(failed.size());
+    finishFlush(std::move(written), std::move(failed), outcome.quarantined, started);
+    return outcome;
+}
+
+int
+InventoryWriteBehind::flushDirtyItems(Database &db)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    PendingMap batch;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        batch.swap(pending_);
+        pendingPerCharacter_.clear();
+    }
+    if (batch.empty())
+        return 0;
+
+    const FlushOutcome outcome = flushBatch(db, std::move(batch));
+    if (outcome.written > 0 && log_->should_log(spdlog::level::debug))
+    {
+        const auto stats = getWriteBehindStats();
+        log_->debug("Inventory write-behind flush: {} item(s) in {} ms, lag {} ms, {} updates merged so far",
+            outcome.written, stats.lastFlushDurationMs, stats.lastFlushLagMs, stats.updatesMerged);
+    }
+    return outcome.written;
+}
+
+bool
+InventoryWriteBehind::flushItem(Database &db, int inventoryItemId)
+{
+    // Held across the write so a barrier also waits for a flush already in progress
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    PendingMap batch;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        auto node = extractLocked(inventoryItemId);
+        if (node.empty())
+            return true;
+        batch.insert(std::move(node));
+    }
+    return flushBatch(db, std::move(batch)).requeued == 0;
+}
+
+bool
+InventoryWriteBehind::flushCharacter(Database &db, int characterId)
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    PendingMap batch;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (pendingPerCharacter_.find(characterId) == pendingPerCharacter_.end())
+            return true;
+
+        std::vector<int> itemIds;
+        for (const auto &[inventoryItemId, entry] : pending_)
+        {
+            if (entry.characterId == characterId)
+                itemIds.push_back(inventoryItemId);
+        }
+        for (int inventoryItemId : itemIds)
+            batch.insert(extractLocked(inventoryItemId));
+    }
+    return flushBatch(db, std::move(batch)).requeued == 0;
+}
+
+InventoryWriteBehind::WriteBehindStats
+InventoryWriteBehind::getWriteBehindStats()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    WriteBehindStats stats = writeBehindStats_;
+    stats.pendingItems = pending_.size();
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto &[inventoryItemId, entry] : pending_)
+    {
+        stats.oldestPendingAgeMs = std::max<int64_t>(stats.oldestPendingAgeMs,
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - entry.dirtySince).count());
+    }
+    return stats;
+}
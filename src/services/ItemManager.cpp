@@ -1,4 +1,5 @@
 #include "services/ItemManager.hpp"
+#include <chrono>
 #include <spdlog/logger.h>
 
 ItemManager::ItemManager(Database &database, Logger &logger)
@@ -12,10 +13,21 @@ ItemManager::ItemManager(Database &database, Logger &logger)
 void
 ItemManager::loadItems()
 {
+    using Clock = std::chrono::steady_clock;
+    auto elapsedMs = [](Clock::time_point since)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count();
+    };
+
     try
     {
+        const auto loadStart = Clock::now();
+        std::map<int, ItemDataStruct> loaded;
+
         auto _dbConn = database_.getConnectionLocked();
         pqxx::work transaction(_dbConn.get());
+
+        auto phaseStart = Clock::now();
         pqxx::result selectItems = database_.executeQueryWithTransaction(
             transaction,
             "get_items",
@@ -28,8 +40,6 @@ ItemManager::loadItems()
             return;
         }
 
-        std::unique_lock<std::shared_mutex> lock(itemsMutex_);
-
         for (const auto &row : selectItems)
         {
             ItemDataStruct itemData;
@@ -59,82 +69,110 @@ ItemManager::loadItems()
             itemData.levelRequirement = row["level_requirement"].as<int>();
             itemData.isTwoHanded = row["is_two_handed"].as<bool>();
 
-            // Load item attributes
-            pqxx::result selectItemAttributes = database_.executeQueryWithTransaction(
-                transaction,
-                "get_item_attributes",
-                {itemData.id});
+            // Social systems (Stage 4, migration 039)
+            itemData.masterySlug = row["mastery_slug"].is_null() ? "" : row["mastery_slug"].as<std::string>();
 
-            for (const auto &attributeRow : selectItemAttributes)
-            {
-                ItemAttributeStruct itemAttribute;
-                itemAttribute.item_id = itemData.id;
-                itemAttribute.id = attributeRow["id"].as<int>();
-                itemAttribute.name = attributeRow["name"].as<std::string>();
-                itemAttribute.slug = attributeRow["slug"].as<std::string>();
-                itemAttribute.value = attributeRow["value"].as<int>();
-                itemAttribute.apply_on = attributeRow["apply_on"].as<std::string>();
-
-                itemData.attributes.push_back(itemAttribute);
-            }
+            loaded.emplace(itemData.id, std::move(itemData));
+        }
+        const auto itemsMs = elapsedMs(phaseStart);
 
-            // Load item use-effects (potions, scrolls, food — migration 034)
-            pqxx::result selectUseEffects = database_.executeQueryWithTransaction(
-                transaction,
-                "get_item_use_effects",
-                {itemData.id});
+        // Load all item attributes in one query and attach them by item_id
+        phaseStart = Clock::now();
+        pqxx::result selectItemAttributes = database_.executeQueryWithTransaction(
+            transaction,
+            "get_item_attributes_all",
+            {});
 
-            for (const auto &ueRow : selectUseEffects)
-            {
-                ItemUseEffectStruct ue;
-                ue.effectSlug = ueRow["effect_slug"].as<std::string>();
-                ue.attributeSlug = ueRow["attribute_slug"].as<std::string>();
-                ue.value = ueRow["value"].as<float>();
-                ue.isInstant = ueRow["is_instant"].as<bool>();
-                ue.durationSeconds = ueRow["duration_seconds"].as<int>();
-                ue.tickMs = ueRow["tick_ms"].as<int>();
-                ue.cooldownSeconds = ueRow["cooldown_seconds"].as<int>();
-                itemData.useEffects.push_back(ue);
-            }
+        for (const auto &attributeRow : selectItemAttributes)
+        {
+            auto itemIt = loaded.find(attributeRow["item_id"].as<int>());
+            if (itemIt == loaded.end())
+                continue;
 
-            // Social systems (Stage 4, migration 039)
-            itemData.masterySlug = row["mastery_slug"].is_null() ? "" : row["mastery_slug"].as<std::string>();
+            ItemAttributeStruct itemAttribute;
+            itemAttribute.item_id = itemIt->first;
+            itemAttribute.id = attributeRow["id"].as<int>();
+            itemAttribute.name = attributeRow["name"].as<std::string>();
+            itemAttribute.slug = attributeRow["slug"].as<std::string>();
+            itemAttribute.value = attributeRow["value"].as<int>();
+            itemAttribute.apply_on = attributeRow["apply_on"].as<std::string>();
+
+            itemIt->second.attributes.push_back(std::move(itemAttribute));
+        }
+        const auto attributesMs = elapsedMs(phaseStart);
+
+        // Load all item use-effects (potions, scrolls, food — migration 034) in one query
+        phaseStart = Clock::now();
+        pqxx::result selectUseEffects = database_.executeQueryWithTransaction(
+            transaction,
+            "get_item_use_effects_all",
+            {});
+
+        for (const auto &ueRow : selectUseEffects)
+        {
+            auto itemIt = loaded.find(ueRow["item_id"].as<int>());
+            if (itemIt == loaded.end())
+                continue;
 
-            items_[itemData.id] = itemData;
+            ItemUseEffectStruct ue;
+            ue.effectSlug = ueRow["effect_slug"].as<std::string>();
+            ue.attributeSlug = ueRow["attribute_slug"].as<std::string>();
+            ue.value = ueRow["value"].as<float>();
+            ue.isInstant = ueRow["is_instant"].as<bool>();
+            ue.durationSeconds = ueRow["duration_seconds"].as<int>();
+            ue.tickMs = ueRow["tick_ms"].as<int>();
+            ue.cooldownSeconds = ueRow["cooldown_seconds"].as<int>();
+            itemIt->second.useEffects.push_back(std::move(ue));
         }
+        const auto useEffectsMs = elapsedMs(phaseStart);
 
         // Load per-class restrictions into the already-built items map
+        phaseStart = Clock::now();
         pqxx::result selectClassRestrictions = database_.executeQueryWithTransaction(
             transaction,
             "get_item_class_restrictions",
             {});
         for (const auto &restrictionRow : selectClassRestrictions)
         {
-            int itemId = restrictionRow["item_id"].as<int>();
-            int classId = restrictionRow["class_id"].as<int>();
-            if (items_.count(itemId))
-                items_[itemId].allowedClassIds.push_back(classId);
+            auto itemIt = loaded.find(restrictionRow["item_id"].as<int>());
+            if (itemIt != loaded.end())
+                itemIt->second.allowedClassIds.push_back(restrictionRow["class_id"].as<int>());
         }
+        const auto restrictionsMs = elapsedMs(phaseStart);
 
         // Load item-set memberships into the already-built items map
+        phaseStart = Clock::now();
         pqxx::result selectSetMembers = database_.executeQueryWithTransaction(
             transaction,
             "get_item_set_memberships",
             {});
         for (const auto &setRow : selectSetMembers)
         {
-            int itemId = setRow["item_id"].as<int>();
-            int setId = setRow["set_id"].as<int>();
-            std::string setSlug = setRow["set_slug"].as<std::string>();
-            if (items_.count(itemId))
+            auto itemIt = loaded.find(setRow["item_id"].as<int>());
+            if (itemIt != loaded.end())
             {
-                items_[itemId].setId = setId;
-                items_[itemId].setSlug = setSlug;
+                itemIt->second.setId = setRow["set_id"].as<int>();
+                itemIt->second.setSlug = setRow["set_slug"].as<std::string>();
             }
         }
+        const auto setsMs = elapsedMs(phaseStart);
 
         transaction.commit();
-        logger_.log("Loaded " + std::to_string(items_.size()) + " items from database");
+
+        const size_t itemCount = loaded.size();
+        {
+            // Readers only block for the swap, not for the queries above
+            std::unique_lock<std::shared_mutex> lock(itemsMutex_);
+            items_.swap(loaded);
+        }
+
+        logger_.log("Loaded " + std::to_string(itemCount) + " items from database");
+        log_->info("[ITEMS] load timing: items=" + std::to_string(itemsMs) + "ms (" + std::to_string(selectItems.size()) + " rows)" +
+                   " attributes=" + std::to_string(attributesMs) + "ms (" + std::to_string(selectItemAttributes.size()) + " rows)" +
+                   " useEffects=" + std::to_string(useEffectsMs) + "ms (" + std::to_string(selectUseEffects.size()) + " rows)" +
+                   " classRestrictions=" + std::to_string(restrictionsMs) + "ms (" + std::to_string(selectClassRestrictions.size()) + " rows)" +
+                   " setMemberships=" + std::to_string(setsMs) + "ms (" + std::to_string(selectSetMembers.size()) + " rows)" +
+                   " total=" + std::to_string(elapsedMs(loadStart)) + "ms");
     }
     catch (const std::exception &e)
     {
@@ -207,6 +245,7 @@ ItemManager::getItemsAsVector() const
 {
     std::shared_lock<std::shared_mutex> lock(itemsMutex_);
     std::vector<ItemDataStruct> itemsVector;
+    itemsVector.reserve(items_.size());
 
     for (const auto &item : items_)
     {
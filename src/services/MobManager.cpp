@@ -15,6 +15,10 @@ MobManager::loadMobs()
 {
     try
     {
+        std::map<int, MobDataStruct> loaded;
+        size_t attributeCount = 0;
+        size_t skillCount = 0;
+
         auto _dbConn = database_.getConnectionLocked();
         pqxx::work transaction(_dbConn.get()); // Start a transaction
         pqxx::result selectMobs = database_.executeQueryWithTransaction(
@@ -26,8 +30,7 @@ MobManager::loadMobs()
         {
             // log that the data is empty
             log_->error("No mobs found in the database");
-            // Rollback the transaction
-            transaction.abort();
+            return;
         }
 
         for (const auto &row : selectMobs)
@@ -80,46 +83,90 @@ MobManager::loadMobs()
             mobData.hpMin = row["hp_min"].as<int>();
             mobData.hpMax = row["hp_max"].as<int>();
 
-            // get mob attributes
-            pqxx::result selectMobAttributes = database_.executeQueryWithTransaction(
-                transaction,
-                "get_mob_attributes",
-                {mobData.id});
+            loaded.emplace(mobData.id, std::move(mobData));
+        }
+
+        // Attributes of every mob in one query (ordered by mob_id, then attribute id).
+        // Apply rankMult to all attributes so elite/boss mobs have proportionally
+        // stronger stats than normal mobs of the same template.
+        pqxx::result selectMobAttributes = database_.executeQueryWithTransaction(
+            transaction,
+            "get_mob_attributes_all",
+            {});
 
-            if (selectMobAttributes.empty())
+        for (const auto &attributeRow : selectMobAttributes)
+        {
+            auto mobIt = loaded.find(attributeRow["mob_id"].as<int>());
+            if (mobIt == loaded.end())
+                continue;
+            MobDataStruct &mobData = mobIt->second;
+
+            MobAttributeStruct mobAttribute;
+            mobAttribute.mob_id = mobData.id;
+            mobAttribute.id = attributeRow["id"].as<int>();
+            mobAttribute.name = attributeRow["name"].as<std::string>();
+            mobAttribute.slug = attributeRow["slug"].as<std::string>();
+
+            // Scale by rank multiplier (normal=1.0, elite=2.0, boss=3.0, …)
+            const int rawValue = attributeRow["value"].as<int>();
+            mobAttribute.value = static_cast<int>(std::round(rawValue * mobData.rankMult));
+
+            if (mobAttribute.slug == "max_health")
             {
-                transaction.abort(); // Rollback the transaction
+                mobData.maxHealth = mobAttribute.value;
             }
-
-            // populate mob attributes
-            // Apply rankMult to all attributes so elite/boss mobs have proportionally
-            // stronger stats than normal mobs of the same template.
-            for (const auto &attributeRow : selectMobAttributes)
+            else if (mobAttribute.slug == "max_mana")
             {
-                MobAttributeStruct mobAttribute;
-                mobAttribute.mob_id = mobData.id;
-                mobAttribute.id = attributeRow["id"].as<int>();
-                mobAttribute.name = attributeRow["name"].as<std::string>();
-                mobAttribute.slug = attributeRow["slug"].as<std::string>();
-
-                // Scale by rank multiplier (normal=1.0, elite=2.0, boss=3.0, …)
-                const int rawValue = attributeRow["value"].as<int>();
-                mobAttribute.value = static_cast<int>(std::round(rawValue * mobData.rankMult));
-
-                if (mobAttribute.slug == "max_health")
-                {
-                    mobData.maxHealth = mobAttribute.value;
-                }
-                else if (mobAttribute.slug == "max_mana")
-                {
-                    mobData.maxMana = mobAttribute.value;
-                }
-
-                mobData.attributes.push_back(mobAttribute);
+                mobData.maxMana = mobAttribute.value;
             }
 
-            mobs_[mobData.id] = mobData;
+            mobData.attributes.push_back(std::move(mobAttribute));
+            ++attributeCount;
+        }
+
+        // Skills of every mob in one query, keyed by mob_id
+        pqxx::result selectMobSkills = database_.executeQueryWithTransaction(
+            transaction,
+            "get_mob_skills_all",
+            {});
+
+        for (const auto &skillRow : selectMobSkills)
+        {
+            auto mobIt = loaded.find(skillRow["mob_id"].as<int>());
+            if (mobIt == loaded.end())
+                continue;
+
+            SkillStruct skill;
+            skill.skillName = skillRow["skill_name"].as<std::string>();
+            skill.skillSlug = skillRow["skill_slug"].as<std::string>();
+            skill.scaleStat = skillRow["scale_stat"].as<std::string>();
+            skill.school = skillRow["school"].as<std::string>();
+            skill.skillEffectType = skillRow["skill_effect_type"].as<std::string>();
+            skill.skillLevel = skillRow["skill_level"].as<int>();
+            skill.coeff = skillRow["coeff"].as<float>();
+            skill.flatAdd = skillRow["flat_add"].as<float>();
+            skill.cooldownMs = skillRow["cooldown_ms"].as<int>();
+            skill.gcdMs = skillRow["gcd_ms"].as<int>();
+            skill.castMs = skillRow["cast_ms"].as<int>();
+            skill.costMp = skillRow["cost_mp"].as<int>();
+            skill.maxRange = skillRow["max_range"].as<float>();
+            skill.areaRadius = skillRow["area_radius"].as<float>();
+            skill.swingMs = skillRow["swing_ms"].as<int>();
+            skill.animationName = skillRow["animation_name"].as<std::string>();
+            mobIt->second.skills.push_back(std::move(skill));
+            ++skillCount;
         }
+
+        transaction.commit();
+
+        const size_t mobCount = loaded.size();
+        {
+            std::unique_lock<std::shared_mutex> lock(mobsMutex_);
+            mobs_.swap(loaded);
+        }
+
+        log_->info("Loaded " + std::to_string(mobCount) + " mobs, " + std::to_string(attributeCount) +
+                   " attributes, " + std::to_string(skillCount) + " skills");
     }
     catch (const std::exception &e)
     {
@@ -131,6 +178,7 @@ MobManager::loadMobs()
 std::map<int, MobDataStruct>
 MobManager::getMobs() const
 {
+    std::shared_lock<std::shared_mutex> lock(mobsMutex_);
     return mobs_;
 }
 
@@ -138,7 +186,9 @@ MobManager::getMobs() const
 std::vector<MobDataStruct>
 MobManager::getMobsAsVector() const
 {
+    std::shared_lock<std::shared_mutex> lock(mobsMutex_);
     std::vector<MobDataStruct> mobs;
+    mobs.reserve(mobs_.size());
     for (const auto &mob : mobs_)
     {
         mobs.push_back(mob.second);
@@ -150,6 +200,7 @@ MobManager::getMobsAsVector() const
 MobDataStruct
 MobManager::getMobById(int mobId) const
 {
+    std::shared_lock<std::shared_mutex> lock(mobsMutex_);
     auto mob = mobs_.find(mobId);
     if (mob != mobs_.end())
     {
@@ -165,6 +216,7 @@ MobManager::getMobById(int mobId) const
 std::map<int, MobAttributeStruct>
 MobManager::getMobsAttributes() const
 {
+    std::shared_lock<std::shared_mutex> lock(mobsMutex_);
     std::map<int, MobAttributeStruct> mobAttributes;
     for (const auto &mob : mobs_)
     {
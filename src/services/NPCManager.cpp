@@ -13,16 +13,31 @@ NPCManager::NPCManager(Database &database, Logger &logger)
 void
 NPCManager::loadNPCs()
 {
-    std::lock_guard<std::mutex> lock(npcsMutex_);
+    std::lock_guard<std::mutex> loadLock(loadMutex_);
 
-    if (loaded_)
+    if (isLoaded())
     {
         log_->info("NPCs already loaded, skipping reload");
         return;
     }
 
+    loadNPCsLocked();
+}
+
+void
+NPCManager::reloadNPCs()
+{
+    std::lock_guard<std::mutex> loadLock(loadMutex_);
+    loadNPCsLocked();
+}
+
+void
+NPCManager::loadNPCsLocked()
+{
     try
     {
+        std::map<int, NPCDataStruct> loaded;
+
         auto _dbConn = database_.getConnectionLocked();
         pqxx::work transaction(_dbConn.get());
 
@@ -77,16 +92,19 @@ NPCManager::loadNPCs()
             if (!row["faction_slug"].is_null())
                 npcData.factionSlug = row["faction_slug"].as<std::string>();
 
-            // Load related data
-            npcData.attributes = loadNPCAttributes(transaction, npcData.id);
-            npcData.skills = loadNPCSkills(transaction, npcData.id);
+            loaded.emplace(npcData.id, std::move(npcData));
+        }
 
-            // loadNPCPosition also fills npcData.zoneId from the placement row
-            npcData.position = loadNPCPosition(transaction, npcData.id, npcData.zoneId);
+        // Load related data — one query per table, grouped by npc_id
+        const size_t attributeRows = loadAllNPCAttributes(transaction, loaded);
+        const size_t skillRows = loadAllNPCSkills(transaction, loaded);
+        loadAllNPCPositions(transaction, loaded); // also fills zoneId from the placement row
+        const size_t questRows = loadAllNPCQuests(transaction, loaded);
 
-            // Load quest slugs for which this NPC is giver or turn-in target
-            npcData.questSlugs = loadNPCQuests(transaction, npcData.id);
+        transaction.commit();
 
+        for (auto &[npcId, npcData] : loaded)
+        {
             // Calculate derived values
             npcData.maxHealth = calculateMaxHealth(npcData.attributes);
             npcData.maxMana = calculateMaxMana(npcData.attributes);
@@ -100,20 +118,25 @@ NPCManager::loadNPCs()
             {
                 npcData.currentMana = npcData.maxMana;
             }
-
-            npcs_[npcData.id] = std::move(npcData);
         }
 
-        transaction.commit();
-        loaded_ = true;
+        const size_t npcCount = loaded.size();
+        {
+            // Readers are only blocked for the swap
+            std::lock_guard<std::mutex> lock(npcsMutex_);
+            npcs_.swap(loaded);
+            loaded_ = true;
+        }
 
-        logger_.log("Successfully loaded " + std::to_string(npcs_.size()) + " NPCs", GREEN);
+        logger_.log("Successfully loaded " + std::to_string(npcCount) + " NPCs (" +
+                        std::to_string(attributeRows) + " attributes, " + std::to_string(skillRows) + " skills, " +
+                        std::to_string(questRows) + " quest links)",
+            GREEN);
     }
     catch (const std::exception &e)
     {
+        // Whatever was loaded before stays in place
         logger_.logError("Error loading NPCs: " + std::string(e.what()));
-        npcs_.clear();
-        loaded_ = false;
     }
 }
 
@@ -187,112 +210,106 @@ NPCManager::getNPCCount() const
     return npcs_.size();
 }
 
-std::vector<NPCAttributeStruct>
-NPCManager::loadNPCAttributes(pqxx::work &transaction, int npcId)
+size_t
+NPCManager::loadAllNPCAttributes(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs)
 {
-    std::vector<NPCAttributeStruct> attributes;
+    size_t attached = 0;
 
-    try
-    {
-        pqxx::result selectAttributes = database_.executeQueryWithTransaction(
-            transaction,
-            "get_npc_attributes",
-            {npcId});
+    pqxx::result selectAttributes = database_.executeQueryWithTransaction(
+        transaction,
+        "get_npc_attributes_all",
+        {});
 
-        for (const auto &attributeRow : selectAttributes)
-        {
-            NPCAttributeStruct attribute;
-            attribute.npc_id = npcId;
-            attribute.id = attributeRow["id"].as<int>();
-            attribute.name = attributeRow["name"].as<std::string>();
-            attribute.slug = attributeRow["slug"].as<std::string>();
-            attribute.value = attributeRow["value"].as<int>();
-
-            attributes.push_back(std::move(attribute));
-        }
-    }
-    catch (const std::exception &e)
+    for (const auto &attributeRow : selectAttributes)
     {
-        logger_.logError("Error loading NPC attributes for NPC ID " + std::to_string(npcId) + ": " + std::string(e.what()));
+        auto npcIt = npcs.find(attributeRow["npc_id"].as<int>());
+        if (npcIt == npcs.end())
+            continue;
+
+        NPCAttributeStruct attribute;
+        attribute.npc_id = npcIt->first;
+        attribute.id = attributeRow["id"].as<int>();
+        attribute.name = attributeRow["name"].as<std::string>();
+        attribute.slug = attributeRow["slug"].as<std::string>();
+        attribute.value = attributeRow["value"].as<int>();
+
+        npcIt->second.attributes.push_back(std::move(attribute));
+        ++attached;
     }
 
-    return attributes;
+    return attached;
 }
 
-std::vector<SkillStruct>
-NPCManager::loadNPCSkills(pqxx::work &transaction, int npcId)
+size_t
+NPCManager::loadAllNPCSkills(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs)
 {
-    std::vector<SkillStruct> skills;
+    size_t attached = 0;
 
-    try
-    {
-        pqxx::result selectSkills = database_.executeQueryWithTransaction(
-            transaction,
-            "get_npc_skills",
-            {npcId});
+    pqxx::result selectSkills = database_.executeQueryWithTransaction(
+        transaction,
+        "get_npc_skills_all",
+        {});
 
-        for (const auto &skillRow : selectSkills)
-        {
-            SkillStruct skill;
-            skill.skillName = skillRow["skill_name"].as<std::string>();
-            skill.skillSlug = skillRow["skill_slug"].as<std::string>();
-            skill.scaleStat = skillRow["scale_stat"].as<std::string>();
-            skill.school = skillRow["school"].as<std::string>();
-            skill.skillEffectType = skillRow["skill_effect_type"].as<std::string>();
-            skill.skillLevel = skillRow["skill_level"].as<int>();
-            skill.coeff = skillRow["coeff"].as<float>();
-            skill.flatAdd = skillRow["flat_add"].as<float>();
-            skill.cooldownMs = skillRow["cooldown_ms"].as<int>();
-            skill.gcdMs = skillRow["gcd_ms"].as<int>();
-            skill.castMs = skillRow["cast_ms"].as<int>();
-            skill.costMp = skillRow["cost_mp"].as<int>();
-            skill.maxRange = skillRow["max_range"].as<float>();
-
-            skill.animationName = skillRow["animation_name"].as<std::string>();
-            skill.swingMs = skillRow["swing_ms"].as<int>();
-            skills.push_back(std::move(skill));
-        }
-    }
-    catch (const std::exception &e)
+    for (const auto &skillRow : selectSkills)
     {
-        logger_.logError("Error loading NPC skills for NPC ID " + std::to_string(npcId) + ": " + std::string(e.what()));
+        auto npcIt = npcs.find(skillRow["npc_id"].as<int>());
+        if (npcIt == npcs.end())
+            continue;
+
+        SkillStruct skill;
+        skill.skillName = skillRow["skill_name"].as<std::string>();
+        skill.skillSlug = skillRow["skill_slug"].as<std::string>();
+        skill.scaleStat = skillRow["scale_stat"].as<std::string>();
+        skill.school = skillRow["school"].as<std::string>();
+        skill.skillEffectType = skillRow["skill_effect_type"].as<std::string>();
+        skill.skillLevel = skillRow["skill_level"].as<int>();
+        skill.coeff = skillRow["coeff"].as<float>();
+        skill.flatAdd = skillRow["flat_add"].as<float>();
+        skill.cooldownMs = skillRow["cooldown_ms"].as<int>();
+        skill.gcdMs = skillRow["gcd_ms"].as<int>();
+        skill.castMs = skillRow["cast_ms"].as<int>();
+        skill.costMp = skillRow["cost_mp"].as<int>();
+        skill.maxRange = skillRow["max_range"].as<float>();
+
+        skill.animationName = skillRow["animation_name"].as<std::string>();
+        skill.swingMs = skillRow["swing_ms"].as<int>();
+        npcIt->second.skills.push_back(std::move(skill));
+        ++attached;
     }
 
-    return skills;
+    return attached;
 }
 
-PositionStruct
-NPCManager::loadNPCPosition(pqxx::work &transaction, int npcId, int &zoneId)
+size_t
+NPCManager::loadAllNPCPositions(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs)
 {
-    PositionStruct position;
+    size_t applied = 0;
 
-    try
-    {
-        pqxx::result selectPosition = database_.executeQueryWithTransaction(
-            transaction,
-            "get_npc_position",
-            {npcId});
+    pqxx::result selectPositions = database_.executeQueryWithTransaction(
+        transaction,
+        "get_npc_positions_all",
+        {});
 
-        if (!selectPosition.empty())
+    for (const auto &row : selectPositions)
+    {
+        auto npcIt = npcs.find(row["npc_id"].as<int>());
+        if (npcIt == npcs.end())
+            continue;
+
+        PositionStruct &position = npcIt->second.position;
+        position.positionX = row["x"].as<float>();
+        position.positionY = row["y"].as<float>();
+        position.positionZ = row["z"].as<float>();
+        position.rotationZ = row["rot_z"].as<float>();
+        // zone_id comes from npc_placements
+        if (!row["zone_id"].is_null())
         {
-            const auto &row = selectPosition[0];
-            position.positionX = row["x"].as<float>();
-            position.positionY = row["y"].as<float>();
-            position.positionZ = row["z"].as<float>();
-            position.rotationZ = row["rot_z"].as<float>();
-            // zone_id comes from npc_placements
-            if (!row["zone_id"].is_null())
-            {
-                zoneId = row["zone_id"].as<int>();
-            }
+            npcIt->second.zoneId = row["zone_id"].as<int>();
         }
-    }
-    catch (const std::exception &e)
-    {
-        logger_.logError("Error loading NPC position for NPC ID " + std::to_string(npcId) + ": " + std::string(e.what()));
+        ++applied;
     }
 
-    return position;
+    return applied;
 }
 
 int
@@ -313,25 +330,24 @@ NPCManager::calculateMaxMana(const std::vector<NPCAttributeStruct> &attributes)
     return (it != attributes.end()) ? it->value : 50; // Default mana
 }
 
-std::vector<std::string>
-NPCManager::loadNPCQuests(pqxx::work &transaction, int npcId)
+size_t
+NPCManager::loadAllNPCQuests(pqxx::work &transaction, std::map<int, NPCDataStruct> &npcs)
 {
-    std::vector<std::string> slugs;
+    size_t attached = 0;
 
-    try
-    {
-        pqxx::result result = database_.executeQueryWithTransaction(
-            transaction,
-            "get_npc_quests",
-            {npcId});
+    pqxx::result result = database_.executeQueryWithTransaction(
+        transaction,
+        "get_npc_quests_all",
+        {});
 
-        for (const auto &row : result)
-            slugs.push_back(row["slug"].as<std::string>());
-    }
-    catch (const std::exception &e)
+    for (const auto &row : result)
     {
-        logger_.logError("Error loading quests for NPC ID " + std::to_string(npcId) + ": " + std::string(e.what()));
+        auto npcIt = npcs.find(row["npc_id"].as<int>());
+        if (npcIt == npcs.end())
+            continue;
+        npcIt->second.questSlugs.push_back(row["slug"].as<std::string>());
+        ++attached;
     }
 
-    return slugs;
+    return attached;
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "services/StaticWorldBundle.hpp"
+#include "utils/TimestampUtils.hpp"
+#include <chrono>
+#include <spdlog/logger.h>
+
+namespace
+{
+/// Header of a cached message as sent now to @p clientId
+nlohmann::json
+receiverHeader(const nlohmann::json &header, bool patchClientId, int clientId)
+{
+    nlohmann::json out = header;
+    out["timestamp"] = TimestampUtils::getCurrentTimestampView();
+    if (patchClientId)
+        out["clientId"] = clientId;
+    return out;
+}
+} // namespace
+
+StaticWorldBundle::StaticWorldBundle(Logger &logger)
+    : logger_(logger)
+{
+    log_ = logger.getSystem("bundle");
+}
+
+std::shared_ptr<const StaticWorldBundle::Snapshot>
+StaticWorldBundle::getOrBuild(const Builder &builder)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (snapshot_)
+            return snapshot_;
+    }
+
+    std::lock_guard<std::mutex> buildLock(buildMutex_);
+
+    uint64_t buildVersion = 0;
+    {
+        // Another join may have finished the build while we waited
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (snapshot_)
+            return snapshot_;
+        buildVersion = version_;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->version = buildVersion;
+    bool complete = builder(snapshot->messages);
+
+    for (const auto &message : snapshot->messages)
+    {
+        snapshot->totalBytes += message.body.size();
+        complete = complete && !message.isError;
+    }
+
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime)
+                         .count();
+
+    if (!complete)
+    {
+        log_->warn("[BUNDLE] v{} built with errors ({} messages, {} bytes, {}ms) — not cached",
+            buildVersion, snapshot->messages.size(), snapshot->totalBytes, elapsedMs);
+        return snapshot;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (version_ != buildVersion)
+    {
+        log_->info("[BUNDLE] v{} invalidated during build — not cached", buildVersion);
+        return snapshot;
+    }
+    snapshot_ = snapshot;
+
+    logger_.log("[BUNDLE] Static world bundle v" + std::to_string(buildVersion) + " built: " +
+                    std::to_string(snapshot->messages.size()) + " messages, " +
+                    std::to_string(snapshot->totalBytes) + " bytes in " + std::to_string(elapsedMs) + "ms",
+        GREEN);
+    return snapshot_;
+}
+
+uint64_t
+StaticWorldBundle::invalidate(const std::string &reason)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot_.reset();
+    ++version_;
+    log_->info("[BUNDLE] Invalidated ({}), next version v{}", reason, version_);
+    return version_;
+}
+
+uint64_t
+StaticWorldBundle::getVersion() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
+}
+
+StaticWorldBundle::Message
+StaticWorldBundle::makeMessage(const std::string &data, int clientId)
+{
+    Message message;
+    nlohmann::json envelope = nlohmann::json::parse(data, nullptr, false);
+    auto body = envelope.is_object() ? envelope.find("body") : envelope.end();
+    auto header = envelope.is_object() ? envelope.find("header") : envelope.end();
+    if (body == envelope.end() || header == envelope.end() || !header->is_object())
+    {
+        // Not a response envelope; kept out of the cache via isError
+        message.body = "null";
+        message.header = {{"status", "error"}};
+        message.isError = true;
+        return message;
+    }
+
+    message.body = body->dump();
+    message.header = std::move(*header);
+    message.header.erase("timestamp");
+    message.isError = message.header.value("status", "") == "error";
+    auto headerClientId = message.header.find("clientId");
+    message.patchClientId = headerClientId != message.header.end() && *headerClientId == clientId;
+    return message;
+}
+
+std::string
+StaticWorldBundle::render(const Message &message, int clientId)
+{
+    const std::string header = receiverHeader(message.header, message.patchClientId, clientId).dump();
+
+    std::string rendered;
+    rendered.reserve(message.body.size() + header.size() + 20);
+    rendered.append("{\"body\":").append(message.body).append(",\"header\":").append(header).append("}\n");
+    return rendered;
+}
+
+std::shared_ptr<const StaticWorldBundle::PreparedMessages>
+StaticWorldBundle::prepared(const Snapshot &snapshot, WireFormat format)
+{
+    auto &slot = snapshot.prepared[static_cast<std::size_t>(format)];
+    std::lock_guard<std::mutex> lock(snapshot.preparedMutex);
+    if (slot)
+        return slot;
+
+    auto messages = std::make_shared<PreparedMessages>();
+    messages->reserve(snapshot.messages.size());
+    for (const auto &message : snapshot.messages)
+    {
+        nlohmann::json envelope = {{"body", nlohmann::json::parse(message.body)}, {"header", message.header}};
+        messages->push_back(WireCodec::prepare(envelope, format));
+    }
+    slot = messages;
+    return slot;
+}
+
+std::string
+StaticWorldBundle::renderFrame(const Message &message,
+    const WireCodec::PreparedEnvelope &prepared,
+    WireFormat format,
+    int clientId)
+{
+    return WireCodec::finishFrame(prepared, receiverHeader(prepared.header, message.patchClientId, clientId), format);
+}
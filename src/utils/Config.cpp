@@ -16,11 +16,22 @@ std::tuple<DatabaseConfig, GameServerConfig> Config::parseConfig() {
     DBConfig.password = getEnvOrDefault("DB_PASSWORD", "");
     DBConfig.host     = getEnvOrDefault("DB_HOST", "127.0.0.1");
     DBConfig.port     = static_cast<short>(std::stoi(getEnvOrDefault("DB_PORT", "5432")));
+    DBConfig.pool_size = std::stoi(getEnvOrDefault("DB_POOL_SIZE", "4"));
 
     GameServerConfig GSConfig;
     GSConfig.host        = getEnvOrDefault("SERVER_HOST", "0.0.0.0");
     GSConfig.port        = static_cast<short>(std::stoi(getEnvOrDefault("SERVER_PORT", "27016")));
     GSConfig.max_clients = static_cast<short>(std::stoi(getEnvOrDefault("SERVER_MAX_CLIENTS", "3000")));
+    GSConfig.max_write_batch_bytes = std::stoul(getEnvOrDefault("SERVER_MAX_WRITE_BATCH_BYTES", "262144"));
+    GSConfig.write_high_watermark  = std::stoul(getEnvOrDefault("SERVER_WRITE_HIGH_WATERMARK", "33554432"));
+    GSConfig.write_low_watermark   = std::stoul(getEnvOrDefault("SERVER_WRITE_LOW_WATERMARK", "8388608"));
+    GSConfig.write_hard_limit      = std::stoul(getEnvOrDefault("SERVER_WRITE_HARD_LIMIT", "134217728"));
+    GSConfig.character_flush_interval_sec = std::stoi(getEnvOrDefault("CHARACTER_FLUSH_INTERVAL_SEC", "10"));
+    GSConfig.inventory_flush_interval_sec = std::stoi(getEnvOrDefault("INVENTORY_FLUSH_INTERVAL_SEC", "5"));
+    GSConfig.analytics_flush_rows        = std::stoul(getEnvOrDefault("ANALYTICS_FLUSH_ROWS", "500"));
+    GSConfig.analytics_flush_interval_ms = std::stoi(getEnvOrDefault("ANALYTICS_FLUSH_INTERVAL_MS", "1000"));
+    GSConfig.analytics_max_buffer_bytes  = std::stoul(getEnvOrDefault("ANALYTICS_MAX_BUFFER_BYTES", "8388608"));
+    GSConfig.analytics_spill_path        = getEnvOrDefault("ANALYTICS_SPILL_PATH", "");
 
     return std::make_tuple(DBConfig, GSConfig);
 }
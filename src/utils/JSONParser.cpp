@@ -6,9 +6,8 @@ JSONParser::JSONParser() {}
 JSONParser::~JSONParser() {}
 
 CharacterDataStruct
-JSONParser::parseCharacterData(const char *data, size_t length)
+JSONParser::parseCharacterData(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     CharacterDataStruct characterData;
 
     if (jsonData.contains("body") && jsonData["body"].is_object() &&
@@ -97,10 +96,15 @@ JSONParser::parseCharacterData(const char *data, size_t length)
     return characterData;
 }
 
+CharacterDataStruct
+JSONParser::parseCharacterData(const char *data, size_t length)
+{
+    return parseCharacterData(nlohmann::json::parse(data, data + length));
+}
+
 PositionStruct
-JSONParser::parsePositionData(const char *data, size_t length)
+JSONParser::parsePositionData(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     PositionStruct positionData;
 
     if (jsonData.contains("body") && jsonData["body"].is_object() &&
@@ -127,10 +131,15 @@ JSONParser::parsePositionData(const char *data, size_t length)
     return positionData;
 }
 
+PositionStruct
+JSONParser::parsePositionData(const char *data, size_t length)
+{
+    return parsePositionData(nlohmann::json::parse(data, data + length));
+}
+
 ClientDataStruct
-JSONParser::parseClientData(const char *data, size_t length)
+JSONParser::parseClientData(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     ClientDataStruct clientData;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -147,10 +156,15 @@ JSONParser::parseClientData(const char *data, size_t length)
     return clientData;
 }
 
+ClientDataStruct
+JSONParser::parseClientData(const char *data, size_t length)
+{
+    return parseClientData(nlohmann::json::parse(data, data + length));
+}
+
 nlohmann::json
-JSONParser::parseCharactersList(const char *data, size_t length)
+JSONParser::parseCharactersList(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     nlohmann::json charactersList;
 
     if (jsonData.contains("body") && jsonData["body"].is_object() &&
@@ -162,10 +176,15 @@ JSONParser::parseCharactersList(const char *data, size_t length)
     return charactersList;
 }
 
+nlohmann::json
+JSONParser::parseCharactersList(const char *data, size_t length)
+{
+    return parseCharactersList(nlohmann::json::parse(data, data + length));
+}
+
 MessageStruct
-JSONParser::parseMessage(const char *data, size_t length)
+JSONParser::parseMessage(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     MessageStruct message;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -182,10 +201,15 @@ JSONParser::parseMessage(const char *data, size_t length)
     return message;
 }
 
+MessageStruct
+JSONParser::parseMessage(const char *data, size_t length)
+{
+    return parseMessage(nlohmann::json::parse(data, data + length));
+}
+
 std::string
-JSONParser::parseEventType(const char *data, size_t length)
+JSONParser::parseEventType(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     std::string eventType;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -197,11 +221,16 @@ JSONParser::parseEventType(const char *data, size_t length)
     return eventType;
 }
 
+std::string
+JSONParser::parseEventType(const char *data, size_t length)
+{
+    return parseEventType(nlohmann::json::parse(data, data + length));
+}
+
 // parse chunk server handshake data
 ChunkInfoStruct
-JSONParser::parseChunkServerHandshakeData(const char *data, size_t length)
+JSONParser::parseChunkServerHandshakeData(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     ChunkInfoStruct chunkData;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -223,10 +252,15 @@ JSONParser::parseChunkServerHandshakeData(const char *data, size_t length)
     return chunkData;
 }
 
+ChunkInfoStruct
+JSONParser::parseChunkServerHandshakeData(const char *data, size_t length)
+{
+    return parseChunkServerHandshakeData(nlohmann::json::parse(data, data + length));
+}
+
 std::vector<CharacterDataStruct>
-JSONParser::parseSavePositionsData(const char *data, size_t length)
+JSONParser::parseSavePositionsData(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     std::vector<CharacterDataStruct> characters;
 
     if (!jsonData.contains("body") || !jsonData["body"].is_object())
@@ -261,13 +295,18 @@ JSONParser::parseSavePositionsData(const char *data, size_t length)
     return characters;
 }
 
+std::vector<CharacterDataStruct>
+JSONParser::parseSavePositionsData(const char *data, size_t length)
+{
+    return parseSavePositionsData(nlohmann::json::parse(data, data + length));
+}
+
 // Parse a "saveCharacterProgress" packet sent by the chunk server.
 // Expected JSON shape:
 //   { "body": { "characters": [ { "characterId": N, "exp": N, "level": N }, ... ] } }
 std::vector<CharacterDataStruct>
-JSONParser::parseSaveCharacterProgressData(const char *data, size_t length)
+JSONParser::parseSaveCharacterProgressData(const nlohmann::json &jsonData)
 {
-    nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
     std::vector<CharacterDataStruct> characters;
 
     if (!jsonData.contains("body") || !jsonData["body"].is_object())
@@ -294,4 +333,10 @@ JSONParser::parseSaveCharacterProgressData(const char *data, size_t length)
     }
 
     return characters;
+}
+
+std::vector<CharacterDataStruct>
+JSONParser::parseSaveCharacterProgressData(const char *data, size_t length)
+{
+    return parseSaveCharacterProgressData(nlohmann::json::parse(data, data + length));
 }
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "utils/JsonStreamWriter.hpp"
+#include "data/DataStructs.hpp"
+#include "utils/TimestampUtils.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+void
+JsonStreamWriter::separate()
+{
+    if (needComma_)
+        out_.push_back(',');
+    needComma_ = true;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::beginObject()
+{
+    separate();
+    out_.push_back('{');
+    needComma_ = false;
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::endObject()
+{
+    out_.push_back('}');
+    needComma_ = true;
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::beginArray()
+{
+    separate();
+    out_.push_back('[');
+    needComma_ = false;
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::endArray()
+{
+    out_.push_back(']');
+    needComma_ = true;
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::key(std::string_view name)
+{
+    separate();
+    appendEscaped(name);
+    out_.push_back(':');
+    needComma_ = false; // the value follows without a separator
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::value(std::string_view text)
+{
+    separate();
+    appendEscaped(text);
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::value(bool flag)
+{
+    separate();
+    out_.append(flag ? "true" : "false");
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::value(std::nullptr_t)
+{
+    separate();
+    out_.append("null");
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::value(double number)
+{
+    separate();
+    // Same rules as nlohmann's serializer: non-finite is null, otherwise the shortest
+    // round-trip form with ".0" kept on integral values
+    if (!std::isfinite(number))
+    {
+        out_.append("null");
+        return *this;
+    }
+    std::array<char, 64> buffer;
+    char *end = nlohmann::detail::to_chars(buffer.data(), buffer.data() + buffer.size(), number);
+    out_.append(buffer.data(), end);
+    return *this;
+}
+
+JsonStreamWriter &
+JsonStreamWriter::value(const nlohmann::json &json)
+{
+    separate();
+    // Serialise in place instead of through a temporary dump() string
+    nlohmann::detail::serializer<nlohmann::json> serializer(
+        nlohmann::detail::output_adapter<char, std::string>(out_), ' ');
+    serializer.dump(json, false, false, 0);
+    return *this;
+}
+
+void
+JsonStreamWriter::appendInteger(long long number)
+{
+    std::array<char, 24> buffer;
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), number);
+    out_.append(buffer.data(), result.ptr);
+}
+
+void
+JsonStreamWriter::appendInteger(unsigned long long number)
+{
+    std::array<char, 24> buffer;
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), number);
+    out_.append(buffer.data(), result.ptr);
+}
+
+void
+JsonStreamWriter::appendEscaped(std::string_view text)
+{
+    static constexpr char HEX[] = "0123456789abcdef";
+
+    out_.push_back('"');
+    std::size_t runStart = 0;
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        const auto c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+
+        // Copy the clean run in one go, then the escape
+        out_.append(text.data() + runStart, i - runStart);
+        runStart = i + 1;
+        switch (c)
+        {
+        case '"':
+            out_.append("\\\"");
+            break;
+        case '\\':
+            out_.append("\\\\");
+            break;
+        case '\b':
+            out_.append("\\b");
+            break;
+        case '\f':
+            out_.append("\\f");
+            break;
+        case '\n':
+            out_.append("\\n");
+            break;
+        case '\r':
+            out_.append("\\r");
+            break;
+        case '\t':
+            out_.append("\\t");
+            break;
+        default:
+        {
+            const char escape[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0x0f]};
+            out_.append(escape, sizeof(escape));
+            break;
+        }
+        }
+    }
+    out_.append(text.data() + runStart, text.size() - runStart);
+    out_.push_back('"');
+}
+
+ResponseStream::ResponseStream()
+    : writer_(buffer_)
+{
+    writer_.beginObject().key("body").beginObject();
+}
+
+std::string
+ResponseStream::finish(std::string_view status, const nlohmann::json &header)
+{
+    writer_.endObject();
+    writeEnvelopeHeader(writer_, status, &header);
+    writer_.endObject();
+    buffer_.push_back('\n');
+    return std::move(buffer_);
+}
+
+namespace
+{
+bool
+isEnvelopeHeaderKey(const std::string &key, bool withTimestamps)
+{
+    if (key == "status" || key == "timestamp" || key == "version")
+        return true;
+    return withTimestamps &&
+           (key == "serverRecvMs" || key == "serverSendMs" || key == "clientSendMsEcho" || key == "requestId");
+}
+} // namespace
+
+void
+writeEnvelopeHeader(JsonStreamWriter &writer,
+    std::string_view status,
+    const nlohmann::json *header,
+    const TimestampStruct *timestamps)
+{
+    writer.key("header").beginObject();
+    if (header && header->is_object())
+    {
+        for (auto field = header->begin(); field != header->end(); ++field)
+        {
+            if (!isEnvelopeHeaderKey(field.key(), timestamps != nullptr))
+                writer.key(field.key()).value(field.value());
+        }
+    }
+    writer.field("status", status);
+    writer.field("timestamp", TimestampUtils::getCurrentTimestampView());
+    writer.field("version", "1.0");
+    if (timestamps)
+    {
+        writer.field("serverRecvMs", timestamps->serverRecvMs)
+            .field("serverSendMs", TimestampUtils::getCurrentTimestampMs())
+            .field("clientSendMsEcho", timestamps->clientSendMsEcho)
+            .field("requestId", timestamps->requestId);
+    }
+    writer.endObject();
+}
+
+nlohmann::json
+makeEnvelopeHeader(std::string_view status,
+    const nlohmann::json *header,
+    const TimestampStruct *timestamps)
+{
+    nlohmann::json out = nlohmann::json::object();
+    if (header && header->is_object())
+    {
+        for (auto field = header->begin(); field != header->end(); ++field)
+        {
+            if (!isEnvelopeHeaderKey(field.key(), timestamps != nullptr))
+                out[field.key()] = field.value();
+        }
+    }
+    out["status"] = status;
+    out["timestamp"] = TimestampUtils::getCurrentTimestampView();
+    out["version"] = "1.0";
+    if (timestamps)
+    {
+        out["serverRecvMs"] = timestamps->serverRecvMs;
+        out["serverSendMs"] = TimestampUtils::getCurrentTimestampMs();
+        out["clientSendMsEcho"] = timestamps->clientSendMsEcho;
+        out["requestId"] = timestamps->requestId;
+    }
+    return out;
+}
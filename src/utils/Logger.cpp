@@ -123,3 +123,20 @@ Logger::getSystem(const std::string &system)
     spdlog::register_logger(child);
     return child;
 }
+
+std::uint32_t
+Logger::sampleRate(std::string_view loggerName, std::uint32_t defaultEvery)
+{
+    const auto dot = loggerName.rfind('.');
+    const std::string_view system = dot == std::string_view::npos ? loggerName : loggerName.substr(dot + 1);
+
+    std::string envKey = "LOG_SAMPLE_";
+    std::transform(system.begin(), system.end(), std::back_inserter(envKey), ::toupper);
+    if (const char *envRate = std::getenv(envKey.c_str()))
+    {
+        const long rate = std::strtol(envRate, nullptr, 10);
+        if (rate > 0)
+            return static_cast<std::uint32_t>(rate);
+    }
+    return defaultEvery > 0 ? defaultEvery : 1;
+}
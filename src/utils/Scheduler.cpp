@@ -1,84 +1,330 @@
 #include "utils/Scheduler.hpp"
 #include <algorithm>
+#include <spdlog/logger.h>
+#include <vector>
 
-Scheduler::Scheduler() : stopFlag(false) {}
+Scheduler::Scheduler(Logger &logger, std::size_t workerThreads)
+    : log_(logger.getSystem("scheduler")),
+      origin_(std::chrono::steady_clock::now()),
+      rng_(std::random_device{}()),
+      executor_(workerThreads)
+{
+}
 
-Scheduler::~Scheduler() {
+Scheduler::~Scheduler()
+{
     stop();
 }
 
-void Scheduler::start() {
-    thread = std::thread(&Scheduler::run, this);
+void
+Scheduler::start()
+{
+    if (!thread_.joinable())
+        thread_ = std::thread(&Scheduler::run, this);
 }
 
-void Scheduler::stop() {
+void
+Scheduler::stop()
+{
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        stopFlag.store(true);
-    }
-    cv.notify_all();
-    if (thread.joinable()) {
-        thread.join();
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopFlag_ = true;
     }
+    cv_.notify_all();
+    if (thread_.joinable())
+        thread_.join();
+
+    // Callers rely on no task running once stop() returns (e.g. the final flush on shutdown)
+    std::unique_lock<std::mutex> lock(mutex_);
+    idleCv_.wait(lock, [this]
+        { return inFlight_ == 0; });
 }
 
-void Scheduler::scheduleTask(const Task &task) {
+Scheduler::TaskHandle
+Scheduler::scheduleTask(Task task)
+{
+    auto state = std::make_shared<TaskState>();
+    state->func = std::move(task.func);
+    state->id = task.id;
+    state->interval = static_cast<std::uint64_t>(std::max<std::int64_t>(0, task.interval.count()));
+    state->jitter = static_cast<std::uint64_t>(std::max<std::int64_t>(0, task.jitter.count()));
+
+    TaskHandle handle;
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        tasksHeap.push(task);
+        std::lock_guard<std::mutex> lock(mutex_);
+        // An idle wheel may lag behind the clock; catching up is free while it is empty
+        if (byHandle_.empty())
+            currentTick_ = std::max(currentTick_, nowTick());
+
+        handle = nextHandle_++;
+        Bucket staging;
+        auto it = staging.emplace(staging.end());
+        it->handle = handle;
+        it->baseTick = std::max(toTick(task.nextRunTime), currentTick_ + 1);
+        it->expiryTick = it->baseTick + jitterFor(*state);
+        it->state = std::move(state);
+        place(staging, it);
+
+        byHandle_.emplace(handle, it);
+        byTaskId_.emplace(task.id, handle);
+        wakeUp_ = true;
     }
-    cv.notify_all();
-}
-
-void Scheduler::removeTask(int id) {
-    std::lock_guard<std::mutex> lock(mutex);
-    // Пересобираем кучу, помечая задачи с заданным id
-    std::vector<Task> temp;
-    while (!tasksHeap.empty()) {
-        Task t = tasksHeap.top();
-        tasksHeap.pop();
-        if (t.id == id) {
-            t.stopFlag = true;
+    cv_.notify_one();
+    return handle;
+}
+
+bool
+Scheduler::cancel(TaskHandle handle)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cancelLocked(handle);
+}
+
+void
+Scheduler::removeTask(int id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TaskHandle> handles;
+    auto range = byTaskId_.equal_range(id);
+    for (auto it = range.first; it != range.second; ++it)
+        handles.push_back(it->second);
+    for (TaskHandle handle : handles)
+        cancelLocked(handle);
+}
+
+bool
+Scheduler::cancelLocked(TaskHandle handle)
+{
+    auto found = byHandle_.find(handle);
+    if (found == byHandle_.end())
+        return false;
+    Bucket::iterator it = found->second;
+    it->state->cancelled.store(true, std::memory_order_relaxed);
+    forget(bucket(it->level, it->slot), it);
+    return true;
+}
+
+void
+Scheduler::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopFlag_)
+    {
+        advanceTo(nowTick());
+        wakeUp_ = false;
+        if (byHandle_.empty())
+        {
+            cv_.wait(lock, [this]
+                { return stopFlag_ || wakeUp_; });
+            continue;
         }
-        temp.push_back(t);
+        const auto deadline = origin_ + std::chrono::milliseconds(nextWakeTick());
+        cv_.wait_until(lock, deadline, [this]
+            { return stopFlag_ || wakeUp_; });
+    }
+}
+
+std::uint64_t
+Scheduler::nowTick() const
+{
+    return toTick(std::chrono::steady_clock::now());
+}
+
+std::uint64_t
+Scheduler::toTick(std::chrono::steady_clock::time_point time) const
+{
+    if (time <= origin_)
+        return 0;
+    return static_cast<std::uint64_t>(std::chrono::ceil<std::chrono::milliseconds>(time - origin_).count());
+}
+
+std::uint64_t
+Scheduler::jitterFor(const TaskState &state)
+{
+    if (state.jitter == 0)
+        return 0;
+    return std::uniform_int_distribution<std::uint64_t>(0, state.jitter)(rng_);
+}
+
+Scheduler::Bucket &
+Scheduler::bucket(std::size_t level, std::size_t slot)
+{
+    return level == 0 ? inner_[slot] : outer_[level - 1][slot];
+}
+
+void
+Scheduler::place(Bucket &from, Bucket::iterator it)
+{
+    Entry &entry = *it;
+    std::uint64_t expiry = std::max(entry.expiryTick, currentTick_);
+    std::uint64_t delta = expiry - currentTick_;
+    if (delta >= WHEEL_SPAN)
+    {
+        // Beyond the outer wheel: park in its furthest slot, re-placed when that comes up
+        expiry = currentTick_ + WHEEL_SPAN - 1;
+        delta = WHEEL_SPAN - 1;
+    }
+
+    if (delta < INNER_SLOTS)
+    {
+        entry.level = 0;
+        entry.slot = expiry & (INNER_SLOTS - 1);
     }
-    for (const auto &t : temp) {
-        tasksHeap.push(t);
+    else
+    {
+        std::size_t level = 1;
+        unsigned shift = INNER_BITS;
+        while (level < OUTER_LEVELS && delta >= (std::uint64_t(1) << (shift + OUTER_BITS)))
+        {
+            ++level;
+            shift += OUTER_BITS;
+        }
+        entry.level = level;
+        entry.slot = (expiry >> shift) & (OUTER_SLOTS - 1);
+        ++outerCount_;
     }
-    cv.notify_all();
+
+    Bucket &to = bucket(entry.level, entry.slot);
+    to.splice(to.end(), from, it); // iterators stay valid, so byHandle_ needs no update
 }
 
-void Scheduler::run() {
-    std::unique_lock<std::mutex> lock(mutex);
-    while (!stopFlag.load()) {
-        if (tasksHeap.empty()) {
-            cv.wait(lock, [this] { return stopFlag.load() || !tasksHeap.empty(); });
-            if (stopFlag.load())
-                break;
+void
+Scheduler::cascade(std::size_t level)
+{
+    const unsigned shift = INNER_BITS + static_cast<unsigned>(level - 1) * OUTER_BITS;
+    Bucket pending;
+    pending.splice(pending.end(), bucket(level, (currentTick_ >> shift) & (OUTER_SLOTS - 1)));
+    outerCount_ -= pending.size();
+    while (!pending.empty())
+        place(pending, pending.begin());
+}
+
+void
+Scheduler::advanceTo(std::uint64_t tick)
+{
+    if (byHandle_.empty())
+    {
+        currentTick_ = std::max(currentTick_, tick);
+        return;
+    }
+
+    while (currentTick_ < tick)
+    {
+        ++currentTick_;
+
+        // When the inner wheel wraps, pull the next slot down from each outer wheel
+        // that wraps with it, coarsest first
+        if ((currentTick_ & (INNER_SLOTS - 1)) == 0 && outerCount_ > 0)
+        {
+            std::size_t levels = 1;
+            std::uint64_t rest = currentTick_ >> INNER_BITS;
+            while (levels < OUTER_LEVELS && (rest & (OUTER_SLOTS - 1)) == 0)
+            {
+                ++levels;
+                rest >>= OUTER_BITS;
+            }
+            for (std::size_t level = levels; level >= 1; --level)
+                cascade(level);
         }
-        // Получаем задачу с минимальным nextRunTime
-        Task t = tasksHeap.top();
-        // Если задача помечена на удаление, просто удаляем её
-        if (t.stopFlag) {
-            tasksHeap.pop();
+
+        Bucket &slot = inner_[currentTick_ & (INNER_SLOTS - 1)];
+        if (slot.empty())
             continue;
+        Bucket due;
+        due.splice(due.end(), slot);
+        while (!due.empty())
+            fire(due, due.begin());
+    }
+}
+
+std::uint64_t
+Scheduler::nextWakeTick() const
+{
+    // Outer timers need a wake-up when the inner wheel wraps to be cascaded
+    const std::uint64_t horizon = outerCount_ > 0
+                                      ? (currentTick_ | (INNER_SLOTS - 1)) + 1
+                                      : currentTick_ + INNER_SLOTS;
+    for (std::uint64_t tick = currentTick_ + 1; tick < horizon; ++tick)
+    {
+        if (!inner_[tick & (INNER_SLOTS - 1)].empty())
+            return tick;
+    }
+    return horizon;
+}
+
+void
+Scheduler::fire(Bucket &due, Bucket::iterator it)
+{
+    Entry &entry = *it;
+    dispatch(entry.state);
+
+    const std::uint64_t interval = entry.state->interval;
+    if (interval == 0)
+    {
+        forget(due, it);
+        return;
+    }
+
+    // Fixed rate: advance the anchor, skipping periods the timer thread slept through
+    std::uint64_t next = entry.baseTick + interval;
+    if (next <= currentTick_)
+        next += ((currentTick_ - next) / interval + 1) * interval;
+    entry.baseTick = next;
+    entry.expiryTick = next + jitterFor(*entry.state);
+    place(due, it);
+}
+
+void
+Scheduler::forget(Bucket &from, Bucket::iterator it)
+{
+    const TaskHandle handle = it->handle;
+    byHandle_.erase(handle);
+    auto range = byTaskId_.equal_range(it->state->id);
+    for (auto idIt = range.first; idIt != range.second; ++idIt)
+    {
+        if (idIt->second == handle)
+        {
+            byTaskId_.erase(idIt);
+            break;
         }
-        auto now = std::chrono::system_clock::now();
-        if (now >= t.nextRunTime) {
-            // Готовая задача – удаляем её из кучи, освобождаем мьютекс и выполняем
-            tasksHeap.pop();
-            lock.unlock();
-            t.func();
-            lock.lock();
-            // Обновляем время следующего запуска и возвращаем задачу в кучу
-            t.nextRunTime = now + std::chrono::seconds(t.interval);
-            tasksHeap.push(t);
-            cv.notify_all();
-        } else {
-            // Ждём до следующего времени выполнения или появления новой задачи с более ранним временем
-            cv.wait_until(lock, t.nextRunTime, [this, &t] {
-                return stopFlag.load() || (!tasksHeap.empty() && tasksHeap.top().nextRunTime < t.nextRunTime);
-            });
+    }
+    if (it->level > 0)
+        --outerCount_;
+    from.erase(it);
+}
+
+void
+Scheduler::dispatch(const std::shared_ptr<TaskState> &state)
+{
+    if (state->running.exchange(true))
+    {
+        log_->warn("Task {} is still running, skipping this period", state->id);
+        return;
+    }
+    ++inFlight_;
+    executor_.enqueueTask(PoolTask([this, state]
+        { runTask(*state); }));
+}
+
+void
+Scheduler::runTask(TaskState &state)
+{
+    if (!state.cancelled.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            state.func();
         }
+        catch (const std::exception &e)
+        {
+            log_->error("Scheduled task {} failed: {}", state.id, e.what());
+        }
+    }
+    state.running.store(false);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --inFlight_;
     }
+    idleCv_.notify_all();
 }
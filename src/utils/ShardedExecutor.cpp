@@ -0,0 +1,113 @@
+#include "utils/ShardedExecutor.hpp"
+
+ShardedExecutor::ShardedExecutor(ThreadPool &pool, std::size_t laneCount)
+    : pool_(pool)
+{
+    if (laneCount == 0)
+        laneCount = 1;
+    lanes_.reserve(laneCount);
+    for (std::size_t i = 0; i < laneCount; ++i)
+        lanes_.push_back(std::make_unique<Lane>());
+}
+
+ShardedExecutor::Lane &
+ShardedExecutor::laneFor(Key key)
+{
+    // splitmix64 finaliser: sequential ids must not cluster on neighbouring lanes
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return *lanes_[key % lanes_.size()];
+}
+
+void
+ShardedExecutor::post(Key key, PoolTask task)
+{
+    Lane &lane = laneFor(key);
+    {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        lane.tasks.push_back(std::move(task));
+        if (lane.scheduled)
+            return;
+        lane.scheduled = true;
+    }
+    pool_.enqueueTask(makeDrainTask(lane));
+}
+
+void
+ShardedExecutor::postBatch(std::vector<std::pair<Key, PoolTask>> &&tasks)
+{
+    std::vector<PoolTask> drains;
+    for (auto &[key, task] : tasks)
+    {
+        Lane &lane = laneFor(key);
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        lane.tasks.push_back(std::move(task));
+        if (!lane.scheduled)
+        {
+            lane.scheduled = true;
+            drains.push_back(makeDrainTask(lane));
+        }
+    }
+    tasks.clear();
+    pool_.enqueueBatch(std::move(drains));
+}
+
+PoolTask
+ShardedExecutor::makeDrainTask(Lane &lane)
+{
+    return PoolTask([this, &lane] { drain(lane); });
+}
+
+void
+ShardedExecutor::drain(Lane &lane)
+{
+    // Budget spent, or a task threw: the lane is handed on either way, never left
+    // marked scheduled with nobody draining it
+    struct HandOnGuard
+    {
+        ShardedExecutor &executor;
+        Lane &lane;
+        bool idle = false;
+        ~HandOnGuard()
+        {
+            if (!idle)
+                executor.handOn(lane);
+        }
+    } guard{*this, lane};
+
+    for (std::size_t executed = 0; executed < DRAIN_BUDGET; ++executed)
+    {
+        PoolTask task;
+        {
+            std::lock_guard<std::mutex> lock(lane.mutex);
+            if (lane.tasks.empty())
+            {
+                lane.scheduled = false;
+                guard.idle = true;
+                return;
+            }
+            task = std::move(lane.tasks.front());
+            lane.tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void
+ShardedExecutor::handOn(Lane &lane)
+{
+    {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        if (lane.tasks.empty())
+        {
+            lane.scheduled = false;
+            return;
+        }
+    }
+    // Work left: requeue so one hot key cannot pin a worker. The lane stays marked
+    // scheduled, so ordering is preserved.
+    pool_.enqueueTask(makeDrainTask(lane));
+}
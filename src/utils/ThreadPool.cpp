@@ -1,25 +1,26 @@
 #include "utils/ThreadPool.hpp"
 #include <stdexcept>
 
+namespace
+{
+// Identifies the pool/worker running on the current thread so that tasks
+// spawned from inside a task go to that worker's own deque.
+thread_local const ThreadPool *currentPool = nullptr;
+thread_local size_t currentWorker = 0;
+} // namespace
+
 ThreadPool::ThreadPool(size_t numThreads)
 {
+    if (numThreads == 0)
+        numThreads = 1;
+
+    queues_.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+        queues_.push_back(std::make_unique<WorkerQueue>());
+
     for (size_t i = 0; i < numThreads; ++i)
     {
-        workers.emplace_back([this]() {
-            while (true)
-            {
-                std::function<void()> task;
-                {
-                    std::unique_lock<std::mutex> lock(this->queueMutex);
-                    condition.wait(lock, [this]() { return stop || !tasks.empty(); });
-                    if (stop && tasks.empty())
-                        return;
-                    task = std::move(tasks.front());
-                    tasks.pop();
-                }
-                task();
-            }
-        });
+        workers.emplace_back([this, i]() { workerLoop(i); });
     }
 }
 
@@ -34,13 +35,153 @@ ThreadPool::~ThreadPool()
         worker.join();
 }
 
-void ThreadPool::enqueueTask(std::function<void()> task)
+void ThreadPool::enqueueTask(PoolTask task)
 {
+    // Workers may still spawn follow-up work while the pool drains on shutdown
+    if (stop && currentPool != this)
+        throw std::runtime_error("enqueue on stopped ThreadPool");
+
+    if (currentPool == this)
+    {
+        WorkerQueue &own = *queues_[currentWorker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.tasks.push_back(std::move(task));
+    }
+    else
     {
+        std::lock_guard<std::mutex> lock(injectMutex_);
+        injected_.push_back(std::move(task));
+    }
+    unfinished_.fetch_add(1);
+    pending_.fetch_add(1);
+    wakeWorkers(1);
+}
+
+void ThreadPool::enqueueBatch(std::vector<PoolTask> &&tasks)
+{
+    if (tasks.empty())
+        return;
+    if (stop)
+        throw std::runtime_error("enqueue on stopped ThreadPool");
+
+    const size_t count = tasks.size();
+    {
+        std::lock_guard<std::mutex> lock(injectMutex_);
+        for (auto &task : tasks)
+            injected_.push_back(std::move(task));
+    }
+    tasks.clear();
+    unfinished_.fetch_add(count);
+    pending_.fetch_add(count);
+    wakeWorkers(count);
+}
+
+void ThreadPool::workerLoop(size_t index)
+{
+    currentPool = this;
+    currentWorker = index;
+
+    while (true)
+    {
+        PoolTask task;
+        if (popLocal(index, task) || popInjected(index, task) || steal(index, task))
+        {
+            pending_.fetch_sub(1);
+            task();
+            if (unfinished_.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(idleMutex_);
+                idleCondition_.notify_all();
+            }
+            continue;
+        }
+
         std::unique_lock<std::mutex> lock(queueMutex);
-        if (stop)
-            throw std::runtime_error("enqueue on stopped ThreadPool");
-        tasks.push(std::move(task));
+        sleepers_.fetch_add(1);
+        condition.wait(lock, [this]() { return stop || pending_.load() > 0; });
+        sleepers_.fetch_sub(1);
+        if (stop && pending_.load() == 0)
+            return;
     }
-    condition.notify_one();
+}
+
+void ThreadPool::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(idleMutex_);
+    idleCondition_.wait(lock, [this]() { return unfinished_.load() == 0; });
+}
+
+bool ThreadPool::popLocal(size_t index, PoolTask &task)
+{
+    WorkerQueue &own = *queues_[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (own.tasks.empty())
+        return false;
+    task = std::move(own.tasks.back());
+    own.tasks.pop_back();
+    return true;
+}
+
+// Takes one injected task to run now plus a fair share of the rest into the local
+// deque, so a large batch spreads across workers through stealing rather than
+// every worker hammering injectMutex_.
+bool ThreadPool::popInjected(size_t index, PoolTask &task)
+{
+    std::deque<PoolTask> share;
+    {
+        std::lock_guard<std::mutex> lock(injectMutex_);
+        if (injected_.empty())
+            return false;
+        task = std::move(injected_.front());
+        injected_.pop_front();
+
+        size_t take = injected_.size() / workers.size();
+        for (size_t i = 0; i < take; ++i)
+        {
+            share.push_back(std::move(injected_.front()));
+            injected_.pop_front();
+        }
+    }
+
+    if (!share.empty())
+    {
+        WorkerQueue &own = *queues_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        // Keep submission order for the owner's LIFO pops: oldest ends up at the back
+        for (auto it = share.rbegin(); it != share.rend(); ++it)
+            own.tasks.push_back(std::move(*it));
+        wakeWorkers(share.size());
+    }
+    return true;
+}
+
+bool ThreadPool::steal(size_t index, PoolTask &task)
+{
+    const size_t count = queues_.size();
+    for (size_t offset = 1; offset < count; ++offset)
+    {
+        WorkerQueue &victim = *queues_[(index + offset) % count];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty())
+            continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+// Dekker-style pairing with the sleeper increment in workerLoop: either the
+// sleeper sees pending_ > 0 in its wait predicate or we see it in sleepers_.
+void ThreadPool::wakeWorkers(size_t count)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers_.load() == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (count > 1)
+        condition.notify_all();
+    else
+        condition.notify_one();
 }
@@ -1,8 +1,21 @@
 #include "utils/TimestampUtils.hpp"
 #include <chrono>
+#include <climits>
 #include <ctime>
-#include <iomanip>
-#include <sstream>
+
+namespace
+{
+struct TimestampCache
+{
+    long long ms = -1;
+    long long second = LLONG_MIN;
+    char text[24] = {}; // "YYYY-MM-DD HH:MM:SS.mmm"
+};
+
+thread_local TimestampCache timestampCache;
+
+constexpr std::size_t TIMESTAMP_LENGTH = 23;
+} // namespace
 
 long long
 TimestampUtils::getCurrentTimestampMs()
@@ -15,13 +28,33 @@ TimestampUtils::getCurrentTimestampMs()
 std::string
 TimestampUtils::getCurrentTimestamp()
 {
-    auto now = std::chrono::system_clock::now();
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-    auto t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream ss;
-    ss << std::put_time(std::localtime(&t), "%Y-%m-%d %H:%M:%S");
-    ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    return ss.str();
+    return std::string(getCurrentTimestampView());
+}
+
+std::string_view
+TimestampUtils::getCurrentTimestampView()
+{
+    TimestampCache &cache = timestampCache;
+    const long long nowMs = getCurrentTimestampMs();
+    if (nowMs != cache.ms)
+    {
+        const long long second = nowMs / 1000;
+        const int millis = static_cast<int>(nowMs % 1000);
+        if (second != cache.second)
+        {
+            std::time_t t = static_cast<std::time_t>(second);
+            std::tm local{};
+            localtime_r(&t, &local);
+            std::strftime(cache.text, sizeof(cache.text), "%Y-%m-%d %H:%M:%S", &local);
+            cache.second = second;
+        }
+        cache.text[19] = '.';
+        cache.text[20] = static_cast<char>('0' + millis / 100);
+        cache.text[21] = static_cast<char>('0' + millis / 10 % 10);
+        cache.text[22] = static_cast<char>('0' + millis % 10);
+        cache.ms = nowMs;
+    }
+    return std::string_view(cache.text, TIMESTAMP_LENGTH);
 }
 
 void
@@ -91,28 +124,3 @@ TimestampUtils::createTimestamp()
     setServerReceiveTimestamp(timestamps);
     return timestamps;
 }
-
-TimestampStruct
-TimestampUtils::parseTimestampsFromBuffer(const std::array<char, 1024> &messageBuffer, size_t messageLength)
-{
-    TimestampStruct timestamps;
-
-    try
-    {
-        // Convert buffer to string
-        std::string messageStr(messageBuffer.data(), messageLength);
-
-        // Parse JSON
-        nlohmann::json json = nlohmann::json::parse(messageStr);
-
-        // Parse timestamps from header
-        timestamps = parseTimestampsFromHeader(json);
-    }
-    catch (const std::exception &e)
-    {
-        // If parsing fails, create default timestamp with current receive time
-        timestamps = createTimestamp();
-    }
-
-    return timestamps;
-}